@@ -0,0 +1,13 @@
+//
+//  CRF++ -- Yet Another CRF toolkit
+//
+//  $Id: crf_test.cpp 1587 2007-02-12 09:00:36Z taku $;
+//
+//  Copyright(C) 2005-2007 Taku Kudo <taku@chasen.org>
+//
+#include "crfpp.h"
+#include "winmain.h"
+
+int main(int argc, char **argv) {
+  return crfpp_test(argc, argv);
+}
@@ -0,0 +1,13 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.4
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package org.chasen.crfpp;
+
+public interface CRFPPConstants {
+  public final static String VERSION = CRFPPJNI.VERSION_get();
+}
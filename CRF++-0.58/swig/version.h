@@ -0,0 +1,3 @@
+namespace CRFPP {
+#define VERSION "0.58"
+}
@@ -1,3 +1,3 @@
 #!/bin/bash
 
-g++ -Wall -O2 -std=c++0x -I./rapidjson/include -o NamedEntityRecognition ./src/main.cpp
+g++ -Wall -O2 -std=c++0x -msse4.2 -I./rapidjson/include -I./CRF++-0.58 -o NamedEntityRecognition ./src/main.cpp ./CRF++-0.58/.libs/libcrfpp.a -pthread
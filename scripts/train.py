@@ -12,13 +12,9 @@ mystem_path = "../mystem"
 mystem_flags = "-ncisd"
 main_program_path = "../NamedEntityRecognition"
 train_file_line_before_signs_file = \
-	'begin-of-file	begin-of-file	NO	NO	L1	begin-of-file	NO	NO	NO	NO	NO	NO	NO	YES	NO	R0	NO	NO'
+	'begin-of-file	begin-of-file	NO	NO	L1	begin-of-file	NO	NO	NO	NO	NO	NO	NO	YES	NO	R0	NO	NO	NO	O	NO'
 train_file_line_after_signs_file = \
-	'end-of-file	end-of-file	NO	NO	L1	end-of-file	NO	NO	NO	NO	NO	NO	NO	YES	NO	R0	NO	NO'
-
-def call_main_program( args, output_filename ):
-	with open( output_filename, 'wb' ) as file:
-		call( [main_program_path] + args, stdout=file )
+	'end-of-file	end-of-file	NO	NO	L1	end-of-file	NO	NO	NO	NO	NO	NO	NO	YES	NO	R0	NO	NO	NO	O	NO'
 
 def save_file_in_cp1251( name ):
 	try:
@@ -62,22 +58,29 @@ def save_tokens_to_ann( filename, ann_filename ):
 			print( ner_type + '\t' + offset + '\t' \
 				+ str( int( offset ) + int( length ) ), file=file )
 		
+names = []
+for ( dirpath, dirnames, filenames ) in walk( texts_path ):
+	for filename in filenames:
+		if filename.endswith( '.txt' ):
+			print( filename )
+			name = texts_path + filename
+			save_file_in_cp1251( name )
+			name += '.cp1251'
+			stem_file( name )
+			name += '.json'
+			save_tokens_to_ann( texts_path + filename[:-4] + '.spans', name )
+			names.append( name )
+
+# prepare *.json.signs for all *.json (and *.json.ann) files by one process
+with open( texts_path + 'train-files.txt', 'w' ) as file:
+	print( '\n'.join( names ), file=file )
+call( [main_program_path, '--prepare-train-dir', texts_path + 'train-files.txt'] )
+
 with open( target_train_file, 'w' ) as file:
-	for ( dirpath, dirnames, filenames ) in walk( texts_path ):
-		for filename in filenames:
-			if filename.endswith( '.txt' ):
-				print( filename )
-				name = texts_path + filename
-				save_file_in_cp1251( name )
-				name += '.cp1251'
-				stem_file( name )
-				name += '.json'
-				save_tokens_to_ann( texts_path + filename[:-4] + '.spans', name )
-				call_main_program( ['--prepare-train-file', name, \
-					name + '.ann'],	name + '.signs' )
-				# save all .sings to target_train_file
-				print( train_file_line_before_signs_file, file=file )
-				print( train_file_line_before_signs_file, file=file )
-				file.write( open( name + '.signs', 'r' ).read() )
-				print( train_file_line_after_signs_file, file=file )
-				print( train_file_line_after_signs_file, file=file )
+	for name in names:
+		# save all .sings to target_train_file
+		print( train_file_line_before_signs_file, file=file )
+		print( train_file_line_before_signs_file, file=file )
+		file.write( open( name + '.signs', 'r' ).read() )
+		print( train_file_line_after_signs_file, file=file )
+		print( train_file_line_after_signs_file, file=file )
@@ -1,23 +1,60 @@
 #include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
 #include <map>
 #include <set>
+#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
 #include <fstream>
+#include <iterator>
 #include <sstream>
 #include <iostream>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <atomic>
+#include <tuple>
+#include <typeinfo>
+#include <type_traits>
 #include <algorithm>
+#include <functional>
+#include <condition_variable>
 #include <unordered_set>
 #include <unordered_map>
 
+#include <sys/types.h>
+#include <sys/stat.h>
+
 #ifdef _WIN32
 #include <Windows.h>
 #undef GetObject // conflicts with rapidjson
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#endif
+
+#if defined( __SSE4_2__ )
+#define RAPIDJSON_SSE42
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+#define RAPIDJSON_SSE2
 #endif
 
-#include <rapidjson/document.h>
-#include <rapidjson/istreamwrapper.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/error/en.h>
+
+#include <crfpp.h>
+#include <darts.h>
 
 using namespace std;
 
@@ -26,6 +63,18 @@ using namespace std;
 const char* const AuxFileRelativePath =
 	"lowercase-cp1251-aux-files/lowercase-cp1251-";
 
+const char* const ModelRelativePath = "model.crf-model";
+
+const char* const GazetteersBundleFileName = "gazetteers.bundle";
+
+const char* const TokensCacheExtension = ".tokens";
+
+const char* const JsonExtension = ".json";
+const char* const TextExtension = ".txt";
+const char* const SignsExtension = ".signs";
+const char* const AnswerExtension = ".ann";
+const char* const Task1Extension = ".task1";
+
 //-----------------------------------------------------------------------------
 
 class CException {
@@ -42,6 +91,348 @@ private:
 	string message;
 };
 
+//-----------------------------------------------------------------------------
+// Output of the modes goes through a buffer of fixed size,
+// the full buffer is passed to the sink at once
+
+class COutputBuffer {
+public:
+	static const size_t DefaultCapacity = 64 * 1024;
+
+	explicit COutputBuffer( size_t capacity = DefaultCapacity ) :
+		buffer( capacity ), size( 0 ) {}
+	virtual ~COutputBuffer() {}
+
+	void Append( const char* data, size_t length );
+	void Append( const char* text ) { Append( text, strlen( text ) ); }
+	void Append( const string& text ) { Append( text.data(), text.length() ); }
+	void Append( char c );
+	// appends decimal digits of the number, without locale of streams
+	void AppendNumber( uint64_t number );
+	// passes the buffered data to the sink, the owner must call it at the end
+	void Flush();
+
+protected:
+	// is called with the whole buffer or with a longer piece of data
+	virtual void write( const char* data, size_t length ) = 0;
+
+private:
+	vector<char> buffer;
+	size_t size;
+
+	COutputBuffer( const COutputBuffer& );
+	COutputBuffer& operator=( const COutputBuffer& );
+};
+
+void COutputBuffer::Append( const char* data, size_t length )
+{
+	if( size + length > buffer.size() ) {
+		Flush();
+		if( length >= buffer.size() ) {
+			write( data, length );
+			return;
+		}
+	}
+	memcpy( buffer.data() + size, data, length );
+	size += length;
+}
+
+void COutputBuffer::Append( char c )
+{
+	if( size == buffer.size() ) {
+		Flush();
+	}
+	buffer[size++] = c;
+}
+
+void COutputBuffer::AppendNumber( uint64_t number )
+{
+	char digits[20];
+	size_t length = sizeof( digits );
+	do {
+		digits[--length] = static_cast<char>( '0' + number % 10 );
+		number /= 10;
+	} while( number > 0 );
+	Append( digits + length, sizeof( digits ) - length );
+}
+
+void COutputBuffer::Flush()
+{
+	if( size > 0 ) {
+		// the buffer is empty even if the sink fails
+		const size_t length = size;
+		size = 0;
+		write( buffer.data(), length );
+	}
+}
+
+// Writes to a stdio file (standard output by default)
+class CFileOutput : public COutputBuffer {
+public:
+	explicit CFileOutput( FILE* _file = stdout ) : file( _file ) {}
+
+protected:
+	virtual void write( const char* data, size_t length );
+
+private:
+	FILE* const file;
+};
+
+void CFileOutput::write( const char* data, size_t length )
+{
+	if( fwrite( data, 1, length, file ) != length || fflush( file ) != 0 ) {
+		throw new CException( "Can't write output" );
+	}
+}
+
+// Appends to a string, e.g. output of a document which is written later
+class CStringOutput : public COutputBuffer {
+public:
+	static const size_t DefaultCapacity = 4 * 1024;
+
+	explicit CStringOutput( string& _text ) :
+		COutputBuffer( DefaultCapacity ), text( _text ) {}
+
+protected:
+	virtual void write( const char* data, size_t length )
+		{ text.append( data, length ); }
+
+private:
+	string& text;
+};
+
+//-----------------------------------------------------------------------------
+
+// Writable text in memory, the text is followed by at least Padding '\0'
+class CTextBuffer {
+public:
+	// SSE4.2 scanning of rapidjson reads aligned blocks of 16 bytes,
+	// so it can read up to 15 bytes after the terminating '\0'
+	static const size_t Padding = 16;
+
+	virtual ~CTextBuffer() {}
+
+	char* Data() const { return data; }
+	size_t Size() const { return size; }
+
+protected:
+	char* data;
+	size_t size;
+
+	CTextBuffer() : data( nullptr ), size( 0 ) {}
+
+private:
+	CTextBuffer( const CTextBuffer& );
+	CTextBuffer& operator=( const CTextBuffer& );
+};
+
+//-----------------------------------------------------------------------------
+
+// Text received from somewhere else than a file
+class CStringBuffer : public CTextBuffer {
+public:
+	// takes the content of the text
+	explicit CStringBuffer( string& text );
+
+private:
+	string buffer;
+};
+
+CStringBuffer::CStringBuffer( string& text )
+{
+	buffer.swap( text );
+	size = buffer.length();
+	buffer.append( Padding, '\0' );
+	data = &buffer[0];
+}
+
+//-----------------------------------------------------------------------------
+
+// Writable private copy of a file content mapped to memory.
+// Changes of the content are not written to the file.
+class CMappedFile : public CTextBuffer {
+public:
+	explicit CMappedFile( const string& fileName );
+	~CMappedFile();
+
+private:
+#ifdef _WIN32
+	vector<char> buffer;
+#else
+	size_t mappedSize;
+#endif
+};
+
+#ifdef _WIN32
+
+CMappedFile::CMappedFile( const string& fileName )
+{
+	ifstream file( fileName, ios::in | ios::binary );
+	if( !file.good() ) {
+		throw new CException( "Can't open file '" + fileName + "'" );
+	}
+	buffer.assign( istreambuf_iterator<char>( file ),
+		istreambuf_iterator<char>() );
+	size = buffer.size();
+	buffer.resize( size + Padding, '\0' );
+	data = buffer.data();
+}
+
+CMappedFile::~CMappedFile()
+{
+}
+
+#else
+
+CMappedFile::CMappedFile( const string& fileName ) :
+	mappedSize( 0 )
+{
+	const int file = open( fileName.c_str(), O_RDONLY );
+	struct stat fileStat;
+	if( file == -1 || fstat( file, &fileStat ) != 0 ) {
+		if( file != -1 ) {
+			close( file );
+		}
+		throw new CException( "Can't open file '" + fileName + "'" );
+	}
+	size = static_cast<size_t>( fileStat.st_size );
+	// zero filled anonymous pages cover the file mapping and
+	// at least Padding bytes after it
+	const size_t pageSize = static_cast<size_t>( sysconf( _SC_PAGESIZE ) );
+	mappedSize = ( ( size + Padding + pageSize - 1 ) / pageSize ) * pageSize;
+	void* region = mmap( nullptr, mappedSize, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+	if( region != MAP_FAILED && size > 0 ) {
+		if( mmap( region, size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_FIXED, file, 0 ) == MAP_FAILED )
+		{
+			munmap( region, mappedSize );
+			region = MAP_FAILED;
+		}
+	}
+	close( file );
+	if( region == MAP_FAILED ) {
+		throw new CException( "Can't map file '" + fileName + "' to memory" );
+	}
+	madvise( region, mappedSize, MADV_SEQUENTIAL );
+	data = static_cast<char*>( region );
+}
+
+CMappedFile::~CMappedFile()
+{
+	munmap( data, mappedSize );
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Reference to a string which is owned by someone else
+// (by buffer of mystem json file or by CTokens)
+class CStringRef {
+public:
+	CStringRef() : data( "" ), length( 0 ) {}
+	CStringRef( const char* _data, size_t _length ) :
+		data( _data ), length( _length ) {}
+
+	const char* Data() const { return data; }
+	size_t Length() const { return length; }
+	bool IsEmpty() const { return ( length == 0 ); }
+	char operator[]( size_t index ) const { return data[index]; }
+	string ToString() const { return string( data, length ); }
+
+	bool operator==( const CStringRef& other ) const;
+	bool operator!=( const CStringRef& other ) const
+		{ return !( *this == other ); }
+	bool operator==( const char* other ) const
+		{ return ( *this == CStringRef( other, strlen( other ) ) ); }
+	bool operator==( const string& other ) const
+		{ return ( *this == CStringRef( other.data(), other.length() ) ); }
+	bool operator!=( const string& other ) const
+		{ return !( *this == other ); }
+
+private:
+	const char* data;
+	size_t length;
+};
+
+bool CStringRef::operator==( const CStringRef& other ) const
+{
+	return ( length == other.length
+		&& memcmp( data, other.data, length ) == 0 );
+}
+
+ostream& operator<<( ostream& output, const CStringRef& str )
+{
+	return output.write( str.Data(), str.Length() );
+}
+
+// FNV-1a
+uint64_t Fnv1aHash( const char* data, size_t size )
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for( size_t i = 0; i < size; i++ ) {
+		hash ^= static_cast<unsigned char>( data[i] );
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+struct CStringRefHash {
+	size_t operator()( const CStringRef& str ) const
+		{ return static_cast<size_t>( Fnv1aHash( str.Data(), str.Length() ) ); }
+};
+
+//-----------------------------------------------------------------------------
+
+typedef uint32_t TStringId;
+
+// Equal strings get the same id. The pool does not own the strings,
+// they must live as long as the pool.
+class CStringPool {
+public:
+	CStringPool() {}
+
+	void Clear();
+	TStringId Intern( const CStringRef& str );
+	bool Find( const CStringRef& str, TStringId& id ) const;
+	size_t Size() const { return strings.size(); }
+	const CStringRef& String( TStringId id ) const { return strings[id]; }
+
+private:
+	vector<CStringRef> strings;
+	unordered_map<CStringRef, TStringId, CStringRefHash> ids;
+
+	CStringPool( const CStringPool& );
+	CStringPool& operator=( const CStringPool& );
+};
+
+void CStringPool::Clear()
+{
+	strings.clear();
+	ids.clear();
+}
+
+TStringId CStringPool::Intern( const CStringRef& str )
+{
+	auto inserted = ids.insert(
+		make_pair( str, static_cast<TStringId>( strings.size() ) ) );
+	if( inserted.second ) {
+		strings.push_back( str );
+	}
+	return inserted.first->second;
+}
+
+bool CStringPool::Find( const CStringRef& str, TStringId& id ) const
+{
+	auto i = ids.find( str );
+	if( i == ids.end() ) {
+		return false;
+	}
+	id = i->second;
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 
 enum TTokenType {
@@ -126,7 +517,7 @@ struct CTextToTokenType {
 	const TTokenType Type;
 };
 
-CTextToTokenType TextToPartOfSpeech[] = {
+constexpr CTextToTokenType TextToPartOfSpeech[] = {
 	{ "A", TT_A },
 	{ "ADV", TT_ADV },
 	{ "ADVPRO", TT_ADVPRO },
@@ -144,24 +535,212 @@ CTextToTokenType TextToPartOfSpeech[] = {
 	{ 0, TT_None }
 };
 
-// returns the part of spich by mystem 'gr'
-TTokenType GetTypeByGr( const string& gr )
+//-----------------------------------------------------------------------------
+
+// grammemes of mystem except parts of speech
+enum TGrammeme {
+	G_Praes, //  
+	G_Inpraes, //  
+	G_Praet, //  
+	G_Nom, //  
+	G_Gen, //  
+	G_Dat, //  
+	G_Acc, //  
+	G_Ins, //  
+	G_Abl, //  
+	G_Part, // 
+	G_Loc, //  
+	G_Voc, //  
+	G_Sg, //  
+	G_Pl, //  
+	G_Ger, // 
+	G_Inf, // 
+	G_Partcp, // 
+	G_Indic, //  
+	G_Imper, //  
+	G_Brev, //  
+	G_Plen, //  
+	G_Poss, //  
+	G_Supr, //  
+	G_Comp, //  
+	G_1p, // 1- 
+	G_2p, // 2- 
+	G_3p, // 3- 
+	G_M, //  
+	G_F, //  
+	G_N, //  
+	G_Mf, //  
+	G_Ipf, //  
+	G_Pf, //  
+	G_Act, //  
+	G_Pass, //  
+	G_Anim, // 
+	G_Inan, // 
+	G_Tran, //  
+	G_Intr, //  
+	G_Parenth, //  
+	G_Awkw, //  
+	G_Abbr, // 
+	G_Obsc, //  
+	G_Dist, //  
+	G_Geo, //  
+	G_Persn, // 
+	G_Famn, // 
+	G_Patrn, // 
+	G_Obsol, //  
+	G_Rare, //  
+	G_Inform, //  
+	G_Indeclinable, // 
+	G_Count
+};
+
+static_assert( G_Count <= 64, "grammemes don't fit TGrammemes" );
+
+// set of grammemes, bit per TGrammeme
+typedef uint64_t TGrammemes;
+
+bool HasGrammeme( TGrammemes grammemes, TGrammeme grammeme )
 {
-	static unordered_map<string, TTokenType> textToPartOfSpeech;
-	if( textToPartOfSpeech.empty() ) {
-		for( int i = 0; TextToPartOfSpeech[i].Text != 0; i++ ) {
-			textToPartOfSpeech.insert( make_pair(
-				TextToPartOfSpeech[i].Text, TextToPartOfSpeech[i].Type ) );
-		}
+	return ( ( grammemes >> grammeme ) & 1 ) != 0;
+}
+
+constexpr const char* GrammemesText[G_Count] = {
+	"praes", "inpraes", "praet",
+	"nom", "gen", "dat", "acc", "ins", "abl", "part", "loc", "voc",
+	"sg", "pl",
+	"ger", "inf", "partcp", "indic", "imper",
+	"brev", "plen", "poss",
+	"supr", "comp",
+	"1p", "2p", "3p",
+	"m", "f", "n", "mf",
+	"ipf", "pf",
+	"act", "pass",
+	"anim", "inan",
+	"tran", "intr",
+	"parenth", "awkw", "abbr", "obsc", "dist", "geo",
+	"persn", "famn", "patrn", "obsol", "rare", "inform",
+	"0"
+};
+
+//-----------------------------------------------------------------------------
+
+// Perfect hash table of the names of parts of speech and grammemes.
+// The table is built at compile time, the factors of the hash are picked
+// so that the names of TextToPartOfSpeech and GrammemesText don't collide,
+// a collision fails the compilation.
+
+// names are numbered by TextToPartOfSpeech and then by GrammemesText
+const size_t NumberOfPartsOfSpeech =
+	sizeof( TextToPartOfSpeech ) / sizeof( TextToPartOfSpeech[0] ) - 1;
+const size_t NumberOfGrNames = NumberOfPartsOfSpeech + G_Count;
+const uint8_t NoGrName = UINT8_MAX;
+const size_t GrHashTableSize = 256;
+
+static_assert( NumberOfGrNames < NoGrName, "names don't fit the hash table" );
+
+constexpr const char* GrNameText( size_t name )
+{
+	return ( name < NumberOfPartsOfSpeech ? TextToPartOfSpeech[name].Text :
+		GrammemesText[name - NumberOfPartsOfSpeech] );
+}
+
+constexpr size_t GrNameLength( const char* text )
+{
+	return ( *text == '\0' ? 0 : 1 + GrNameLength( text + 1 ) );
+}
+
+constexpr size_t GrHash( const char* text, size_t length )
+{
+	return ( static_cast<unsigned char>( text[0] )
+		+ ( length > 1 ? static_cast<unsigned char>( text[1] ) : 0 ) * 29
+		+ static_cast<unsigned char>( text[length - 1] ) * 125
+		+ length ) % GrHashTableSize;
+}
+
+constexpr size_t GrNameHash( size_t name )
+{
+	return GrHash( GrNameText( name ), GrNameLength( GrNameText( name ) ) );
+}
+
+// the first name from the name with the hash or NoGrName
+constexpr uint8_t GrNameByHash( size_t hash, size_t name = 0 )
+{
+	return ( name == NumberOfGrNames ? NoGrName :
+		( GrNameHash( name ) == hash ? static_cast<uint8_t>( name ) :
+			GrNameByHash( hash, name + 1 ) ) );
+}
+
+constexpr bool GrNameCollides( size_t name, size_t other )
+{
+	return ( other < NumberOfGrNames
+		&& ( GrNameHash( name ) == GrNameHash( other )
+			|| GrNameCollides( name, other + 1 ) ) );
+}
+
+constexpr bool GrNamesCollide( size_t name = 0 )
+{
+	return ( name < NumberOfGrNames
+		&& ( GrNameCollides( name, name + 1 ) || GrNamesCollide( name + 1 ) ) );
+}
+
+static_assert( !GrNamesCollide(), "the hash of gr names is not perfect" );
+
+#define GR_NAMES_4( h ) GrNameByHash( h ), GrNameByHash( h + 1 ), \
+	GrNameByHash( h + 2 ), GrNameByHash( h + 3 )
+#define GR_NAMES_16( h ) GR_NAMES_4( h ), GR_NAMES_4( h + 4 ), \
+	GR_NAMES_4( h + 8 ), GR_NAMES_4( h + 12 )
+#define GR_NAMES_64( h ) GR_NAMES_16( h ), GR_NAMES_16( h + 16 ), \
+	GR_NAMES_16( h + 32 ), GR_NAMES_16( h + 48 )
+
+// names by their hashes
+constexpr uint8_t GrHashTable[GrHashTableSize] = {
+	GR_NAMES_64( 0 ), GR_NAMES_64( 64 ),
+	GR_NAMES_64( 128 ), GR_NAMES_64( 192 )
+};
+
+#undef GR_NAMES_64
+#undef GR_NAMES_16
+#undef GR_NAMES_4
+
+// returns NoGrName for unknown names
+size_t FindGrName( const char* text, size_t length )
+{
+	if( length == 0 ) {
+		return NoGrName;
+	}
+	const size_t name = GrHashTable[GrHash( text, length )];
+	if( name != NoGrName && strlen( GrNameText( name ) ) == length
+		&& memcmp( GrNameText( name ), text, length ) == 0 )
+	{
+		return name;
+	}
+	return NoGrName;
+}
+
+// returns the part of speech by mystem 'gr' (like "S,m,anim=(acc,sg|gen,sg)")
+// and the grammemes of all its analysis alternatives
+TTokenType GetTypeByGr( const char* gr, TGrammemes& grammemes )
+{
+	const char* const delimiters = ",=|() ";
+
+	grammemes = 0;
+	size_t length = strcspn( gr, ",=" );
+	if( gr[length] == '\0' ) {
+		return TT_None;
 	}
-	size_t pos = gr.find_first_of( ",=" );
-	if( pos != string::npos ) {
-		auto i = textToPartOfSpeech.find( gr.substr( 0, pos ) );
-		if( i != textToPartOfSpeech.end() ) {
-			return i->second;
+	const size_t partOfSpeech = FindGrName( gr, length );
+	if( partOfSpeech >= NumberOfPartsOfSpeech ) {
+		return TT_None;
+	}
+	for( const char* text = gr + length; *text != '\0'; text += length ) {
+		text += strspn( text, delimiters );
+		length = strcspn( text, delimiters );
+		const size_t name = FindGrName( text, length );
+		if( name != NoGrName && name >= NumberOfPartsOfSpeech ) {
+			grammemes |= TGrammemes( 1 ) << ( name - NumberOfPartsOfSpeech );
 		}
 	}
-	return TT_None;
+	return TextToPartOfSpeech[partOfSpeech].Type;
 }
 
 //-----------------------------------------------------------------------------
@@ -180,25 +759,31 @@ CTextToTokenType PunctuationsToPartOfSpeech[] = {
 	{ 0, TT_None }
 };
 
-char MarkToLex( TTokenType tokenType )
+CStringRef MarkToLex( TTokenType tokenType )
 {
 	assert( IsMark( tokenType ) );
-	return PunctuationsToPartOfSpeech[tokenType - TT_Comma].Text[0];
+	return CStringRef( PunctuationsToPartOfSpeech[tokenType - TT_Comma].Text, 1 );
 }
 
-TTokenType GetTypeByPunctuation( char punctuation )
+unordered_map<char, TTokenType> CreatePunctuationsToPartOfSpeech()
 {
-	static unordered_map<char, TTokenType> punctuationsToPartOfSpeech;
-	if( punctuationsToPartOfSpeech.empty() ) {
-		for( int i = 0; PunctuationsToPartOfSpeech[i].Text != 0; i++ ) {
-			for( const char* c = PunctuationsToPartOfSpeech[i].Text;
-				*c != '\0'; ++c )
-			{
-				punctuationsToPartOfSpeech.insert( make_pair( *c,
-					PunctuationsToPartOfSpeech[i].Type ) );
-			}
+	unordered_map<char, TTokenType> punctuationsToPartOfSpeech;
+	for( int i = 0; PunctuationsToPartOfSpeech[i].Text != 0; i++ ) {
+		for( const char* c = PunctuationsToPartOfSpeech[i].Text;
+			*c != '\0'; ++c )
+		{
+			punctuationsToPartOfSpeech.insert( make_pair( *c,
+				PunctuationsToPartOfSpeech[i].Type ) );
 		}
 	}
+	return punctuationsToPartOfSpeech;
+}
+
+TTokenType GetTypeByPunctuation( char punctuation )
+{
+	// initialization of static local variable is thread safe
+	static const unordered_map<char, TTokenType> punctuationsToPartOfSpeech =
+		CreatePunctuationsToPartOfSpeech();
 	auto i = punctuationsToPartOfSpeech.find( punctuation );
 	if( i != punctuationsToPartOfSpeech.end() ) {
 		return i->second;
@@ -222,69 +807,348 @@ const char* const NamedEntityTypesText[] = {
 	"Person"
 };
 
+//-----------------------------------------------------------------------------
+// Shape of the text of a token, it is computed by one pass over the text
+// and the register, vowel and length signs are read from it.
+
+// classes of cp1251 characters
+enum TCharClass {
+	CC_Upper = 1 << 0,
+	CC_Vowel = 1 << 1,
+	CC_Digit = 1 << 2,
+	CC_Latin = 1 << 3,
+	CC_Cyrillic = 1 << 4
+};
+
+constexpr const char* UppercaseLetters =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+	"Ũ";
+
+constexpr const char* VowelLetters =
+	"" "aeiou"
+	"ި" "AEIOU";
+
+constexpr bool IsCharIn( const char* chars, unsigned char c )
+{
+	return ( *chars != '\0'
+		&& ( static_cast<unsigned char>( *chars ) == c
+			|| IsCharIn( chars + 1, c ) ) );
+}
+
+constexpr uint8_t CharClass( unsigned char c )
+{
+	return ( ( IsCharIn( UppercaseLetters, c ) ? CC_Upper : 0 )
+		| ( IsCharIn( VowelLetters, c ) ? CC_Vowel : 0 )
+		| ( c >= '0' && c <= '9' ? CC_Digit : 0 )
+		| ( ( c >= 'A' && c <= 'Z' ) || ( c >= 'a' && c <= 'z' ) ?
+			CC_Latin : 0 )
+		| ( c >= 0xC0 || c == 0xA8 || c == 0xB8 ? CC_Cyrillic : 0 ) );
+}
+
+#define CHAR_CLASSES_4( c ) CharClass( c ), CharClass( c + 1 ), \
+	CharClass( c + 2 ), CharClass( c + 3 )
+#define CHAR_CLASSES_16( c ) CHAR_CLASSES_4( c ), CHAR_CLASSES_4( c + 4 ), \
+	CHAR_CLASSES_4( c + 8 ), CHAR_CLASSES_4( c + 12 )
+#define CHAR_CLASSES_64( c ) CHAR_CLASSES_16( c ), CHAR_CLASSES_16( c + 16 ), \
+	CHAR_CLASSES_16( c + 32 ), CHAR_CLASSES_16( c + 48 )
+
+constexpr uint8_t CharClasses[256] = {
+	CHAR_CLASSES_64( 0 ), CHAR_CLASSES_64( 64 ),
+	CHAR_CLASSES_64( 128 ), CHAR_CLASSES_64( 192 )
+};
+
+#undef CHAR_CLASSES_64
+#undef CHAR_CLASSES_16
+#undef CHAR_CLASSES_4
+
+// bits of TTokenShape
+enum TTokenShapeFlag {
+	TSF_FirstUpper = 1 << 0,
+	TSF_RestUpper = 1 << 1, // all the characters after the first one
+	TSF_RestLower = 1 << 2, // none of the characters after the first one
+	TSF_HasVowel = 1 << 3,
+	TSF_HasDigit = 1 << 4,
+	TSF_HasLatin = 1 << 5,
+	TSF_HasCyrillic = 1 << 6,
+	TSF_HasOther = 1 << 7, // neither a letter nor a digit
+	TSF_LengthShift = 8 // TTokenShapeLength
+};
+
+enum TTokenShapeLength {
+	TSL_1,
+	TSL_2_4,
+	TSL_5Plus
+};
+
+typedef uint16_t TTokenShape;
+
+TTokenShape GetTokenShape( const CStringRef& text )
+{
+	if( text.IsEmpty() ) {
+		return 0;
+	}
+	const unsigned char* c =
+		reinterpret_cast<const unsigned char*>( text.Data() );
+	const uint8_t first = CharClasses[c[0]];
+	uint8_t restOr = 0;
+	uint8_t restAnd = ~0;
+	bool hasOther = ( ( first & ( CC_Digit | CC_Latin | CC_Cyrillic ) ) == 0 );
+	for( size_t i = 1; i < text.Length(); i++ ) {
+		const uint8_t charClass = CharClasses[c[i]];
+		restOr |= charClass;
+		restAnd &= charClass;
+		hasOther |= ( ( charClass & ( CC_Digit | CC_Latin | CC_Cyrillic ) ) == 0 );
+	}
+	const uint8_t all = first | restOr;
+	const TTokenShapeLength length = ( text.Length() == 1 ? TSL_1 :
+		( text.Length() >= 5 ? TSL_5Plus : TSL_2_4 ) );
+	return static_cast<TTokenShape>(
+		( ( first & CC_Upper ) != 0 ? TSF_FirstUpper : 0 )
+		| ( ( restAnd & CC_Upper ) != 0 ? TSF_RestUpper : 0 )
+		| ( ( restOr & CC_Upper ) == 0 ? TSF_RestLower : 0 )
+		| ( ( all & CC_Vowel ) != 0 ? TSF_HasVowel : 0 )
+		| ( ( all & CC_Digit ) != 0 ? TSF_HasDigit : 0 )
+		| ( ( all & CC_Latin ) != 0 ? TSF_HasLatin : 0 )
+		| ( ( all & CC_Cyrillic ) != 0 ? TSF_HasCyrillic : 0 )
+		| ( hasOther ? TSF_HasOther : 0 )
+		| ( length << TSF_LengthShift ) );
+}
+
+TTokenShapeLength GetShapeLength( TTokenShape shape )
+{
+	return static_cast<TTokenShapeLength>( shape >> TSF_LengthShift );
+}
+
+//-----------------------------------------------------------------------------
+
+// Values of all the columns of a token of CTokens
 struct CToken {
 	TTokenType Type;
-	string Lex;
-	string Text;
+	CStringRef Lex;
+	CStringRef Text;
+	// ids of Lex and Text in the string pool of tokens
+	TStringId LexId;
+	TStringId TextId;
+	TGrammemes Grammemes;
+	TTokenShape Shape;
 	bool IsEndOfSentence;
 	TNamedEntityType NamedEntityType;
 
 	CToken( TTokenType tokenType = TT_None,
-			const string& lex = "", const string& text = "" ) :
+			const CStringRef& lex = CStringRef(),
+			const CStringRef& text = CStringRef() ) :
 		Type( tokenType ),
 		Lex( lex ),
 		Text( text ),
+		LexId( 0 ),
+		TextId( 0 ),
+		Grammemes( 0 ),
+		Shape( 0 ),
 		IsEndOfSentence( false ),
 		NamedEntityType( NET_None )
 	{
 	}
 
-	void Print() const;
+	void Print( COutputBuffer& output ) const;
 };
 
-void CToken::Print() const
+void CToken::Print( COutputBuffer& output ) const
 {
-	cout << "{" << TokenTypesText[Type] << "}"
-		<< "{" << Text << "}" << "{" << Lex << "}"
-		<< ( IsEndOfSentence ? " end of sentence." : "" )
-		<< endl;
+	output.Append( '{' );
+	output.Append( TokenTypesText[Type] );
+	output.Append( "}{" );
+	output.Append( Text.Data(), Text.Length() );
+	output.Append( "}{" );
+	output.Append( Lex.Data(), Lex.Length() );
+	output.Append( "}{" );
+	const char* separator = "";
+	for( int i = 0; i < G_Count; i++ ) {
+		if( HasGrammeme( Grammemes, static_cast<TGrammeme>( i ) ) ) {
+			output.Append( separator );
+			output.Append( GrammemesText[i] );
+			separator = ",";
+		}
+	}
+	output.Append( '}' );
+	if( IsEndOfSentence ) {
+		output.Append( " end of sentence." );
+	}
+	output.Append( '\n' );
 }
 
 //-----------------------------------------------------------------------------
 
-class CTokens : public vector<CToken> {
+// Tokens of a document stored by columns, so a pass over tokens touches
+// only the columns it needs. Text and Lex of tokens refer to the source
+// buffer of tokens, they are interned in the string pool.
+class CTokens {
 public:
-	void AddWord( const char* text, const char* lex, const char* gr );
-	void AddPunctuationMarks( const char* text );
+	CTokens() {}
+
+	void SetSource( const shared_ptr<CTextBuffer>& source );
+	const CStringPool& Strings() const { return strings; }
+	// interns a string of the source
+	TStringId Intern( const CStringRef& str ) { return strings.Intern( str ); }
+
+	size_t Size() const { return types.size(); }
+	bool IsEmpty() const { return types.empty(); }
+	void Reserve( size_t size );
+
+	TTokenType Type( size_t index ) const
+		{ return static_cast<TTokenType>( types[index] ); }
+	TStringId LexId( size_t index ) const { return lexIds[index]; }
+	TStringId TextId( size_t index ) const { return textIds[index]; }
+	TGrammemes Grammemes( size_t index ) const { return grammemes[index]; }
+	TTokenShape Shape( size_t index ) const { return shapes[index]; }
+	const CStringRef& Lex( size_t index ) const
+		{ return strings.String( lexIds[index] ); }
+	const CStringRef& Text( size_t index ) const
+		{ return strings.String( textIds[index] ); }
+	bool IsEndOfSentence( size_t index ) const
+		{ return ( endOfSentenceFlags[index] != 0 ); }
+	TNamedEntityType NamedEntityType( size_t index ) const
+		{ return static_cast<TNamedEntityType>( namedEntityTypes[index] ); }
+	// offsets of the token in the source text, marks have zero length
+	// (their text is a part of the preceding TT_Text token)
+	size_t BeginOffset( size_t index ) const { return beginOffsets[index]; }
+	size_t EndOffset( size_t index ) const;
+	// index of the first token since the from token which begins
+	// at the offset or after it
+	size_t FindByOffset( size_t offset, size_t from = 0 ) const;
+	// assembles values of all the columns
+	CToken operator[]( size_t index ) const;
+
+	void SetEndOfSentence( size_t index ) { endOfSentenceFlags[index] = 1; }
+	void SetNamedEntityType( size_t index, TNamedEntityType type )
+		{ namedEntityTypes[index] = static_cast<uint8_t>( type ); }
+
+	void AddWord( const CStringRef& text, const CStringRef& lex,
+		const char* gr );
+	void AddWord( TTokenType tokenType, const CStringRef& text,
+		const CStringRef& lex, TGrammemes grammemes = 0 );
+	void AddPunctuationMarks( const CStringRef& text );
+	void AddInterned( TTokenType tokenType, TStringId lexId,
+		TStringId textId, TGrammemes grammemes = 0 );
+
+private:
+	shared_ptr<CTextBuffer> source;
+	CStringPool strings;
+	// columns
+	vector<uint8_t> types;
+	vector<TStringId> lexIds;
+	vector<TStringId> textIds;
+	vector<TGrammemes> grammemes;
+	vector<TTokenShape> shapes;
+	vector<uint8_t> endOfSentenceFlags;
+	vector<uint8_t> namedEntityTypes;
+	vector<size_t> beginOffsets;
+
+	CTokens( const CTokens& );
+	CTokens& operator=( const CTokens& );
 };
 
-void CTokens::AddWord( const char* text, const char* lex, const char* gr )
+void CTokens::SetSource( const shared_ptr<CTextBuffer>& _source )
 {
-	TTokenType tokenType = GetTypeByGr( gr );
-	if( tokenType != TT_None ) {
-		push_back( CToken( tokenType, lex, text ) );
-	}
+	types.clear();
+	lexIds.clear();
+	textIds.clear();
+	grammemes.clear();
+	shapes.clear();
+	endOfSentenceFlags.clear();
+	namedEntityTypes.clear();
+	beginOffsets.clear();
+	strings.Clear();
+	source = _source;
 }
 
-void CTokens::AddPunctuationMarks( const char* text )
+void CTokens::Reserve( size_t size )
 {
-	if( string( text ) == "\\s" ) { // end of sentence
-		auto ri = rbegin();
-		while( ri != rend() && !IsWordOrMark( ri->Type ) ) {
-			++ri;
-		}
-		if( ri != rend() ) {
-			ri->IsEndOfSentence = true;
-		}
-		return;
-	}
+	types.reserve( size );
+	lexIds.reserve( size );
+	textIds.reserve( size );
+	grammemes.reserve( size );
+	shapes.reserve( size );
+	endOfSentenceFlags.reserve( size );
+	namedEntityTypes.reserve( size );
+	beginOffsets.reserve( size );
+}
 
-	if( empty() || back().Type != TT_Text ) {
-		push_back( CToken( TT_Text ) );
+size_t CTokens::EndOffset( size_t index ) const
+{
+	assert( Type( index ) != TT_None );
+	if( IsMark( Type( index ) ) ) {
+		return beginOffsets[index];
+	}
+	return ( beginOffsets[index] + Text( index ).Length() );
+}
+
+size_t CTokens::FindByOffset( size_t offset, size_t from ) const
+{
+	assert( from <= beginOffsets.size() );
+	return static_cast<size_t>( lower_bound( beginOffsets.cbegin() + from,
+		beginOffsets.cend(), offset ) - beginOffsets.cbegin() );
+}
+
+CToken CTokens::operator[]( size_t index ) const
+{
+	CToken token( Type( index ), Lex( index ), Text( index ) );
+	token.LexId = lexIds[index];
+	token.TextId = textIds[index];
+	token.Grammemes = grammemes[index];
+	token.Shape = shapes[index];
+	token.IsEndOfSentence = IsEndOfSentence( index );
+	token.NamedEntityType = NamedEntityType( index );
+	return token;
+}
+
+void CTokens::AddWord( const CStringRef& text, const CStringRef& lex,
+	const char* gr )
+{
+	TGrammemes wordGrammemes;
+	TTokenType tokenType = GetTypeByGr( gr, wordGrammemes );
+	if( tokenType != TT_None ) {
+		AddWord( tokenType, text, lex, wordGrammemes );
+	}
+}
+
+void CTokens::AddWord( TTokenType tokenType, const CStringRef& text,
+	const CStringRef& lex, TGrammemes wordGrammemes )
+{
+	AddInterned( tokenType, Intern( lex ), Intern( text ), wordGrammemes );
+}
+
+void CTokens::AddInterned( TTokenType tokenType, TStringId lexId,
+	TStringId textId, TGrammemes wordGrammemes )
+{
+	beginOffsets.push_back( types.empty() ? 0 : EndOffset( types.size() - 1 ) );
+	types.push_back( static_cast<uint8_t>( tokenType ) );
+	lexIds.push_back( lexId );
+	textIds.push_back( textId );
+	grammemes.push_back( wordGrammemes );
+	shapes.push_back( GetTokenShape( strings.String( textId ) ) );
+	endOfSentenceFlags.push_back( 0 );
+	namedEntityTypes.push_back( NET_None );
+}
+
+void CTokens::AddPunctuationMarks( const CStringRef& text )
+{
+	if( text == "\\s" ) { // end of sentence
+		size_t i = types.size();
+		while( i > 0 && !IsWordOrMark( Type( i - 1 ) ) ) {
+			i--;
+		}
+		if( i > 0 ) {
+			SetEndOfSentence( i - 1 );
+		}
+		return;
 	}
-	back().Text += text;
 
-	for( const char* c = text; *c != '\0'; c++ ) {
+	// each piece of text is a TT_Text token of its own,
+	// so it is interned once as it is in the source
+	AddWord( TT_Text, text, CStringRef() );
+
+	for( size_t i = 0; i < text.Length(); i++ ) {
+		const char* c = text.Data() + i;
 		if( *c == ' ' ) {
 			continue;
 		}
@@ -292,889 +1156,4515 @@ void CTokens::AddPunctuationMarks( const char* text )
 		if( tokenType == TT_None ) {
 			continue;
 		}
-		push_back( CToken( tokenType,
-			string( 1, MarkToLex( tokenType ) ), string( 1, *c ) ) );
+		AddWord( tokenType, CStringRef( c, 1 ), MarkToLex( tokenType ) );
 	}
 }
 
 //-----------------------------------------------------------------------------
-// CBaseSign
-
-class CBaseSign {
-public:
-	CBaseSign() {}
-
-	static const char* const BinarySignTrue;
-	static const char* const BinarySignFalse;
-
-	virtual string Value( const CToken& token ) const = 0;
-
-private:
-	CBaseSign( const CBaseSign& );
-	CBaseSign& operator=( const CBaseSign& );
-};
-
-const char* const CBaseSign::BinarySignTrue = "YES";
-const char* const CBaseSign::BinarySignFalse = "NO";
+// reads not empty lines of the file
+void ReadWordsFile( const string& fileName, unordered_set<string>& words )
+{
+	ifstream file( fileName );
+	while( file.good() ) {
+		string word;
+		getline( file, word );
+		if( !word.empty() ) {
+			words.insert( word );
+		}
+	}
+	if( words.empty() ) {
+		throw new CException( "File '" + fileName + "' is empty" );
+	}
+}
 
 //-----------------------------------------------------------------------------
-// CSigns
-
-class CSigns : public vector<shared_ptr<CBaseSign> > {
-public:
-	void AddSign( CBaseSign* sign );
-	void Apply( const CToken& token, string& result,
-		const string& signsSep = "\t" ) const;
-};
 
-void CSigns::AddSign( CBaseSign* sign )
+bool GetFileSizeAndTime( const string& fileName,
+	uint64_t& size, int64_t& modificationTime )
 {
-	push_back( shared_ptr<CBaseSign>( sign ) );
+	struct stat fileStat;
+	if( stat( fileName.c_str(), &fileStat ) != 0 ) {
+		return false;
+	}
+	size = static_cast<uint64_t>( fileStat.st_size );
+	modificationTime = static_cast<int64_t>( fileStat.st_mtime );
+	return true;
 }
 
-void CSigns::Apply( const CToken& token, string& result,
-	const string& signsSep ) const
+//-----------------------------------------------------------------------------
+
+// Writes the parts to a temporary file and renames it to the file,
+// so other processes reading the file at the same time see the old
+// or the new file, returns false on error
+bool WriteFileByRename( const string& fileName,
+	const vector<CStringRef>& parts )
 {
-	result.clear();
-	for( auto i = cbegin(); i != cend(); ++i ) {
-		string signValue = ( *i )->Value( token );
-		assert( !signValue.empty() );
-		if( !result.empty() ) {
-			result += signsSep;
+	const string tempFileName = fileName + ".tmp";
+	{
+		ofstream file( tempFileName, ios::out | ios::binary );
+		for( auto i = parts.cbegin(); i != parts.cend(); ++i ) {
+			file.write( i->Data(), i->Length() );
 		}
-		result += signValue;
+		if( !file.good() ) {
+			file.close();
+			remove( tempFileName.c_str() );
+			return false;
+		}
+	}
+	remove( fileName.c_str() ); // rename doesn't replace on Windows
+	if( rename( tempFileName.c_str(), fileName.c_str() ) != 0 ) {
+		remove( tempFileName.c_str() );
+		return false;
 	}
+	return true;
 }
 
 //-----------------------------------------------------------------------------
-// CTextSign
 
-class CTextSign : public CBaseSign {
-public:
-	virtual string Value( const CToken& token ) const;
+// Compiled bundle of all lists of words of the aux files directory
+// (see --compile-gazetteers), it is mapped to memory as is.
+// Layout: header, records of lists, records of words of lists (sorted
+// in each list), double array trie of all words, blob of names and words.
+// Value of a word in the trie is the mask of indices of lists with it.
+// The bundle is used while sizes and modification times of all its
+// text lists are the same as at the moment of its compilation.
+
+struct CGazetteersBundleHeader {
+	char Magic[8];
+	uint32_t Version;
+	uint32_t NumberOfLists;
+	uint64_t NumberOfWords;
+	uint64_t TrieSize;
+	uint64_t BlobSize;
+	// FNV-1a of the bundle after the header, it is checked
+	// by --compile-gazetteers and --verify-gazetteers
+	uint64_t Checksum;
 };
 
-string CTextSign::Value( const CToken& token ) const
-{
-	assert( IsWordOrMark( token.Type ) );
-	return token.Text;
-}
-
-//-----------------------------------------------------------------------------
-// CLexSign
+struct CGazetteersBundleList {
+	uint32_t NameOffset;
+	uint32_t NameLength;
+	uint64_t FirstWord;
+	uint64_t NumberOfWords;
+	uint64_t SourceSize;
+	int64_t SourceModificationTime;
+};
 
-class CLexSign : public CBaseSign {
-public:
-	virtual string Value( const CToken& token ) const;
+struct CGazetteersBundleString {
+	uint64_t Offset;
+	uint32_t Length;
+	uint32_t Reserved;
 };
 
-string CLexSign::Value( const CToken& token ) const
-{
-	assert( IsWordOrMark( token.Type ) );
-	return token.Lex;
-}
+const char GazetteersBundleMagic[8] =
+	{ 'N', 'E', 'R', 'G', 'A', 'Z', 'S', '\0' };
+const uint32_t GazetteersBundleVersion = 1;
+// masks of lists are int values of darts
+const size_t GazetteersBundleMaxNumberOfLists = 31;
 
-//-----------------------------------------------------------------------------
-// CNamedEntityTypeSign
+typedef CRFPP::Darts::DoubleArray TGazetteersTrie;
 
-class CNamedEntityTypeSign : public CBaseSign {
-public:
-	virtual string Value( const CToken& token ) const;
-};
+// checks the header and the sizes of the parts of the bundle,
+// it doesn't read the parts, so it is done by every start
+bool CheckGazetteersBundleHeader( const CTextBuffer& file )
+{
+	if( file.Size() < sizeof( CGazetteersBundleHeader ) ) {
+		return false;
+	}
+	const CGazetteersBundleHeader* header =
+		reinterpret_cast<const CGazetteersBundleHeader*>( file.Data() );
+	return ( memcmp( header->Magic, GazetteersBundleMagic,
+			sizeof( GazetteersBundleMagic ) ) == 0
+		&& header->Version == GazetteersBundleVersion
+		&& header->NumberOfLists <= GazetteersBundleMaxNumberOfLists
+		&& header->TrieSize % sizeof( uint64_t ) == 0
+		&& file.Size() == sizeof( CGazetteersBundleHeader )
+			+ header->NumberOfLists * sizeof( CGazetteersBundleList )
+			+ header->NumberOfWords * sizeof( CGazetteersBundleString )
+			+ header->TrieSize + header->BlobSize );
+}
 
-string CNamedEntityTypeSign::Value( const CToken& token ) const
+// builds the trie of the words with their masks of lists
+void BuildGazetteersTrie( const map<string, uint32_t>& wordMasks,
+	TGazetteersTrie& trie )
 {
-	assert( IsWordOrMark( token.Type ) );
-	return NamedEntityTypesText[token.NamedEntityType];
+	// keys of the map are sorted as darts needs
+	vector<char*> keys;
+	vector<size_t> lengths;
+	vector<int> values;
+	for( auto i = wordMasks.cbegin(); i != wordMasks.cend(); ++i ) {
+		if( i->first.find( '\0' ) != string::npos ) {
+			throw new CException( "Gazetteer word '" + i->first
+				+ "' has zero byte" );
+		}
+		keys.push_back( const_cast<char*>( i->first.c_str() ) );
+		lengths.push_back( i->first.length() );
+		values.push_back( static_cast<int>( i->second ) );
+	}
+	trie.clear();
+	if( !keys.empty() && trie.build( keys.size(), keys.data(),
+		lengths.data(), values.data() ) != 0 )
+	{
+		throw new CException( "Can't build trie of gazetteers" );
+	}
 }
 
 //-----------------------------------------------------------------------------
-// CLetterSign
+// CAuxFiles
 
-class CLetterSign : public CBaseSign {
+// Lists of words of signs, the name of a list is the name of its text
+// file without the aux files path. Lists are taken from the compiled
+// bundle if it is fresh, otherwise they are read from the text files.
+class CAuxFiles {
 public:
-	CLetterSign( const char* letters );
+	explicit CAuxFiles( const string& auxFilesPath );
+
+	const string& Path() const { return path; }
+	bool HasBundle() const { return static_cast<bool>( bundle ); }
 
-	bool IsLetterSatisfy( char letter ) const;
+	void ReadWords( const string& name, unordered_set<string>& words ) const;
+	// sets the trie of the bundle if it has all the lists,
+	// listBits are bits of masks of the lists in the trie
+	bool GetTrie( const vector<string>& names, vector<uint32_t>& listBits,
+		TGazetteersTrie& trie ) const;
 
 private:
-	vector<bool> mask;
+	string path;
+	shared_ptr<CMappedFile> bundle;
+	// parts of the bundle
+	const CGazetteersBundleHeader* header;
+	const CGazetteersBundleList* lists;
+	const CGazetteersBundleString* strings;
+	const char* trieData;
+	const char* blob;
+
+	void openBundle( const string& bundleFileName );
+	CStringRef listName( size_t list ) const;
+	bool findList( const string& name, size_t& list ) const;
+
+	CAuxFiles( const CAuxFiles& );
+	CAuxFiles& operator=( const CAuxFiles& );
 };
 
-CLetterSign::CLetterSign( const char* letters )
+CAuxFiles::CAuxFiles( const string& auxFilesPath ) :
+	path( auxFilesPath ),
+	header( nullptr ),
+	lists( nullptr ),
+	strings( nullptr ),
+	trieData( nullptr ),
+	blob( nullptr )
 {
-	const unsigned char Size = ~0;
-	mask.resize( Size + 1 );
-	for( int i = 0; letters[i] != '\0'; i++ ) {
-		vector<bool>::size_type f = static_cast<unsigned char>( letters[i] );
-		mask[f] = true;
-	}
+	openBundle( path + GazetteersBundleFileName );
 }
 
-bool CLetterSign::IsLetterSatisfy( char letter ) const
+void CAuxFiles::ReadWords( const string& name,
+	unordered_set<string>& words ) const
 {
-	return mask[static_cast<unsigned char>( letter )];
+	size_t list;
+	if( !findList( name, list ) ) {
+		ReadWordsFile( path + name, words );
+		return;
+	}
+	const CGazetteersBundleList& bundleList = lists[list];
+	for( uint64_t i = 0; i < bundleList.NumberOfWords; i++ ) {
+		const CGazetteersBundleString& word =
+			strings[bundleList.FirstWord + i];
+		words.insert( string( blob + word.Offset, word.Length ) );
+	}
 }
 
-//-----------------------------------------------------------------------------
-// CRegisterSign
+bool CAuxFiles::GetTrie( const vector<string>& names,
+	vector<uint32_t>& listBits, TGazetteersTrie& trie ) const
+{
+	listBits.clear();
+	for( auto i = names.cbegin(); i != names.cend(); ++i ) {
+		size_t list;
+		if( !findList( *i, list ) ) {
+			return false;
+		}
+		listBits.push_back( static_cast<uint32_t>( list ) );
+	}
+	// darts doesn't change the array of the private mapping
+	trie.set_array( const_cast<char*>( trieData ),
+		header->TrieSize / trie.unit_size() );
+	return true;
+}
 
-class CRegisterSign : public CLetterSign {
-public:
-	CRegisterSign() :
-		CLetterSign( UppercaseLetters )
+// the bundle is an optimization only, so a bad or stale bundle is ignored
+void CAuxFiles::openBundle( const string& bundleFileName )
+{
+	struct stat bundleStat;
+	if( stat( bundleFileName.c_str(), &bundleStat ) != 0
+		|| static_cast<size_t>( bundleStat.st_size )
+			< sizeof( CGazetteersBundleHeader ) )
 	{
+		return;
+	}
+	// the contents are checked by --compile-gazetteers, so the start
+	// takes time independent of the size of the bundle
+	shared_ptr<CMappedFile> file( new CMappedFile( bundleFileName ) );
+	if( !CheckGazetteersBundleHeader( *file ) ) {
+		return;
 	}
 
-	static const char* const UppercaseLetters;
-
-	virtual string Value( const CToken& token ) const;
-};
+	header = reinterpret_cast<const CGazetteersBundleHeader*>( file->Data() );
+	lists = reinterpret_cast<const CGazetteersBundleList*>( header + 1 );
+	strings = reinterpret_cast<const CGazetteersBundleString*>(
+		lists + header->NumberOfLists );
+	trieData = reinterpret_cast<const char*>(
+		strings + header->NumberOfWords );
+	blob = trieData + header->TrieSize;
+	bool isValid = true;
+	for( uint32_t i = 0; i < header->NumberOfLists && isValid; i++ ) {
+		const CGazetteersBundleList& list = lists[i];
+		uint64_t sourceSize;
+		int64_t sourceModificationTime;
+		isValid = static_cast<uint64_t>( list.NameOffset ) + list.NameLength
+				<= header->BlobSize
+			&& list.FirstWord + list.NumberOfWords <= header->NumberOfWords
+			&& GetFileSizeAndTime( path + listName( i ).ToString(),
+				sourceSize, sourceModificationTime )
+			&& list.SourceSize == sourceSize
+			&& list.SourceModificationTime == sourceModificationTime;
+	}
+	if( isValid ) {
+		bundle = file;
+	}
+}
 
-const char* const CRegisterSign::UppercaseLetters =
-	"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-	"Ũ";
+CStringRef CAuxFiles::listName( size_t list ) const
+{
+	return CStringRef( blob + lists[list].NameOffset, lists[list].NameLength );
+}
 
-string CRegisterSign::Value( const CToken& token ) const
+bool CAuxFiles::findList( const string& name, size_t& list ) const
 {
-	assert( IsWordOrMark( token.Type ) );
-	if( IsWord( token.Type ) ) {
-		assert( !token.Text.empty() );
-		bool allInUppercase = true;
-		bool allInLowercase = true;
-		for( string::size_type i = 1; i < token.Text.length(); i++ ) {
-			const bool isLetterInUppercase = IsLetterSatisfy( token.Text[i] );
-			allInUppercase &= isLetterInUppercase;
-			allInLowercase &= !isLetterInUppercase;
-		}
-		const bool isFirstLetterInUppercase = IsLetterSatisfy( token.Text[0] );
-		if( isFirstLetterInUppercase && allInUppercase ) {
-			return "BigBig";
-		} else if( isFirstLetterInUppercase && allInLowercase ) {
-			return "BigSmall";
-		} else if( !isFirstLetterInUppercase && allInLowercase ) {
-			return "Small";
-		}
-		return "Fence";
+	if( !bundle ) {
+		return false;
 	}
-	return BinarySignFalse;
+	for( list = 0; list < header->NumberOfLists; list++ ) {
+		if( listName( list ) == name ) {
+			return true;
+		}
+	}
+	return false;
 }
 
 //-----------------------------------------------------------------------------
-// CHasVowelLetterSign
+// CGazetteers
 
-class CHasVowelLetterSign : public CLetterSign {
+// Lists of lexes in one double array trie, value of a lex
+// is the mask of the lists containing the lex
+class CGazetteers {
 public:
-	CHasVowelLetterSign() :
-		CLetterSign( WovelLetters )
-	{
-	}
+	explicit CGazetteers( const shared_ptr<const CAuxFiles>& auxFiles );
 
-	static const char* const WovelLetters;
+	// returns index of the list
+	size_t AddList( const string& name );
+	// is called after all lists are added
+	void Build();
+	uint32_t ListMask( size_t list ) const;
+	uint32_t Mask( const CStringRef& lex ) const;
 
-	virtual string Value( const CToken& token ) const;
+private:
+	// keeps the mapped bundle with the trie
+	shared_ptr<const CAuxFiles> auxFiles;
+	vector<string> names;
+	vector<uint32_t> listBits;
+	bool isBuilt;
+	TGazetteersTrie trie;
+
+	CGazetteers( const CGazetteers& );
+	CGazetteers& operator=( const CGazetteers& );
 };
 
-const char* const CHasVowelLetterSign::WovelLetters =
-	"" "aeiou"
-	"ި" "AEIOU";
+CGazetteers::CGazetteers( const shared_ptr<const CAuxFiles>& _auxFiles ) :
+	auxFiles( _auxFiles ),
+	isBuilt( false )
+{
+}
 
-string CHasVowelLetterSign::Value( const CToken& token ) const
+size_t CGazetteers::AddList( const string& name )
 {
-	assert( IsWordOrMark( token.Type ) );
-	if( IsWord( token.Type ) ) {
-		assert( !token.Text.empty() );
-		for( string::size_type i = 0; i < token.Text.length(); i++ ) {
-			if( IsLetterSatisfy( token.Text[i] ) ) {
-				return BinarySignTrue;
+	assert( !isBuilt );
+	if( names.size() >= GazetteersBundleMaxNumberOfLists ) {
+		throw new CException( "Too many gazetteers, can't add '"
+			+ name + "'" );
+	}
+	names.push_back( name );
+	return names.size() - 1;
+}
+
+void CGazetteers::Build()
+{
+	assert( !isBuilt );
+	if( !auxFiles->GetTrie( names, listBits, trie ) ) {
+		map<string, uint32_t> lexMasks;
+		listBits.clear();
+		for( size_t i = 0; i < names.size(); i++ ) {
+			unordered_set<string> words;
+			auxFiles->ReadWords( names[i], words );
+			for( auto word = words.cbegin(); word != words.cend(); ++word ) {
+				lexMasks[*word] |= 1U << i;
 			}
+			listBits.push_back( static_cast<uint32_t>( i ) );
 		}
+		BuildGazetteersTrie( lexMasks, trie );
 	}
-	return BinarySignFalse;
+	isBuilt = true;
 }
 
-//-----------------------------------------------------------------------------
-// CTextLengthSign
-
-class CTextLengthSign : public CBaseSign {
-public:
-	virtual string Value( const CToken& token ) const;
-};
+uint32_t CGazetteers::ListMask( size_t list ) const
+{
+	assert( isBuilt );
+	return ( 1U << listBits[list] );
+}
 
-string CTextLengthSign::Value( const CToken& token ) const
+uint32_t CGazetteers::Mask( const CStringRef& lex ) const
 {
-	assert( IsWordOrMark( token.Type ) );
-	if( IsMark( token.Type ) || token.Text.length() == 1 ) {
-		return "L1";
-	} else if( token.Text.length() >= 5 ) {
-		return "L5+";
-	} else {
-		return "L2-4";
+	assert( isBuilt );
+	// zero length means zero terminated key for darts
+	if( lex.IsEmpty() || trie.size() == 0 ) {
+		return 0;
 	}
+	const int mask = trie.exactMatchSearch<int>( lex.Data(), lex.Length() );
+	return ( mask < 0 ? 0 : static_cast<uint32_t>( mask ) );
 }
 
 //-----------------------------------------------------------------------------
-// CTokenTypeSign
+// CSignRows
 
-class CTokenTypeSign : public CBaseSign {
+// Indices of tokens of rows of sign values and
+// data of the rows shared by several signs
+class CSignRows {
 public:
-	virtual string Value( const CToken& token ) const;
-};
+	CSignRows() : masksGazetteers( nullptr ) {}
 
-string CTokenTypeSign::Value( const CToken& token ) const
-{
-	assert( IsWordOrMark( token.Type ) );
-	return TokenTypesText[token.Type];
-}
+	// rows of tokens [begin, end) except TT_Text tokens
+	void Reset( const CTokens& tokens, size_t begin, size_t end );
+	void Reset( const vector<size_t>& indices );
 
-//-----------------------------------------------------------------------------
-// CIsEndOfSentenceSign
+	size_t Size() const { return indices.size(); }
+	// index of token of the row
+	size_t operator[]( size_t row ) const { return indices[row]; }
 
-class CIsEndOfSentenceSign : public CBaseSign {
-public:
-	virtual string Value( const CToken& token ) const;
+	// masks of lexes of rows in gazetteers, found once for all signs
+	const vector<uint32_t>& GazetteersMasks( const CTokens& tokens,
+		const CGazetteers& gazetteers ) const;
+
+private:
+	vector<size_t> indices;
+	mutable const CGazetteers* masksGazetteers;
+	mutable vector<uint32_t> masks;
+
+	CSignRows( const CSignRows& );
+	CSignRows& operator=( const CSignRows& );
 };
 
-string CIsEndOfSentenceSign::Value( const CToken& token ) const
+void CSignRows::Reset( const CTokens& tokens, size_t begin, size_t end )
 {
-	assert( IsWordOrMark( token.Type ) );
-	if( token.IsEndOfSentence ) {
-		return BinarySignTrue;
+	indices.clear();
+	for( size_t i = begin; i < end; i++ ) {
+		assert( tokens.Type( i ) != TT_None );
+		if( tokens.Type( i ) != TT_Text ) {
+			indices.push_back( i );
+		}
 	}
-	return BinarySignFalse;
+	masksGazetteers = nullptr;
 }
 
-//-----------------------------------------------------------------------------
-// CFileSign
-
-class CFileSign : public CBaseSign {
-public:
-	CFileSign( const string& fileName );
-
-protected:
-	unordered_set<string> words;
-};
+void CSignRows::Reset( const vector<size_t>& _indices )
+{
+	indices = _indices;
+	masksGazetteers = nullptr;
+}
 
-CFileSign::CFileSign( const string& fileName )
+const vector<uint32_t>& CSignRows::GazetteersMasks( const CTokens& tokens,
+	const CGazetteers& gazetteers ) const
 {
-	ifstream file( fileName );
-	while( file.good() ) {
-		string word;
-		getline( file, word );
-		if( !word.empty() ) {
-			words.insert( word );
+	if( masksGazetteers != &gazetteers ) {
+		masks.resize( indices.size() );
+		for( size_t i = 0; i < indices.size(); i++ ) {
+			masks[i] = gazetteers.Mask( tokens.Lex( indices[i] ) );
 		}
+		masksGazetteers = &gazetteers;
 	}
-	if( words.empty() ) {
-		throw new CException( "File '" + fileName + "' is empty" );
-	}
+	return masks;
 }
 
 //-----------------------------------------------------------------------------
-// CLexFromFileSign
+// CBaseSign
+
+// Value of a sign is an index in the texts of values of the sign
+// (or an id in the string pool of tokens for the text signs)
+typedef uint32_t TSignValue;
 
-class CLexFromFileSign : public CFileSign {
+class CBaseSign {
 public:
-	CLexFromFileSign( const string& fileName ) :
-		CFileSign( fileName )
-	{
-	}
+	CBaseSign();
+	template<size_t ValuesSize>
+	explicit CBaseSign( const char* const ( &values )[ValuesSize] );
+	virtual ~CBaseSign() {}
+
+	static const TSignValue BinarySignFalse = 0;
+	static const TSignValue BinarySignTrue = 1;
+
+	virtual TSignValue Value( const CToken& token ) const = 0;
+	// fills the column of values of the sign of the tokens,
+	// rows are indices of the tokens
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+	// the value depends only on the lex and on IsWord( type ) of a token
+	virtual bool DependsOnLex() const { return false; }
+	// values are less than it, 0 if values are ids of strings
+	virtual size_t NumberOfValues() const { return valuesText.size(); }
+	// text of the value for CRF++
+	virtual const CStringRef& ValueText( TSignValue value,
+		const CStringPool& strings ) const;
+
+private:
+	vector<CStringRef> valuesText;
 
-	virtual string Value( const CToken& token ) const;
+	CBaseSign( const CBaseSign& );
+	CBaseSign& operator=( const CBaseSign& );
 };
 
-string CLexFromFileSign::Value( const CToken& token ) const
+const char* const BinarySignValues[] = { "NO", "YES" };
+
+CBaseSign::CBaseSign()
 {
-	assert( IsWordOrMark( token.Type ) );
-	if( IsWord( token.Type ) ) {
-		auto i = words.find( token.Lex );
-		if( i != words.end() ) {
-			return BinarySignTrue;
-		}		
+	for( size_t i = 0; i < 2; i++ ) {
+		valuesText.push_back( CStringRef( BinarySignValues[i],
+			strlen( BinarySignValues[i] ) ) );
 	}
-	return BinarySignFalse;
 }
 
-//-----------------------------------------------------------------------------
-// CHasPrefixFromFileSign
-
-class CHasPrefixFromFileSign : public CFileSign {
-public:
-	CHasPrefixFromFileSign( const string& fileName ) :
-		CFileSign( fileName )
-	{
+template<size_t ValuesSize>
+CBaseSign::CBaseSign( const char* const ( &values )[ValuesSize] )
+{
+	for( size_t i = 0; i < ValuesSize; i++ ) {
+		valuesText.push_back( CStringRef( values[i], strlen( values[i] ) ) );
 	}
+}
 
-	virtual string Value( const CToken& token ) const;
-};
+void CBaseSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = Value( tokens[rows[i]] );
+	}
+}
 
-string CHasPrefixFromFileSign::Value( const CToken& token ) const
+const CStringRef& CBaseSign::ValueText( TSignValue value,
+	const CStringPool& /* strings */ ) const
 {
-	return BinarySignFalse;
+	assert( value < valuesText.size() );
+	return valuesText[value];
 }
 
 //-----------------------------------------------------------------------------
-// CHasSuffixFromFileSign
+// CSignValues
 
-class CHasSuffixFromFileSign : public CFileSign {
+// Values of signs of a span of tokens stored by columns of signs,
+// a row per token except TT_Text tokens
+class CSignValues {
 public:
-	CHasSuffixFromFileSign( const string& fileName ) :
-		CFileSign( fileName )
-	{
-	}
+	CSignValues() : numberOfSigns( 0 ) {}
+
+	void Reset( const CTokens& tokens, size_t begin, size_t end,
+		size_t numberOfSigns );
+	void Reset( const vector<size_t>& rows, size_t numberOfSigns );
+
+	const CSignRows& Rows() const { return rows; }
+	size_t NumberOfRows() const { return rows.Size(); }
+	size_t NumberOfSigns() const { return numberOfSigns; }
+
+	TSignValue* Column( size_t sign )
+		{ return values.data() + sign * rows.Size(); }
+	TSignValue Value( size_t row, size_t sign ) const
+		{ return values[sign * rows.Size() + row]; }
+
+private:
+	CSignRows rows;
+	size_t numberOfSigns;
+	vector<TSignValue> values;
 
-	virtual string Value( const CToken& token ) const;
+	CSignValues( const CSignValues& );
+	CSignValues& operator=( const CSignValues& );
 };
 
-string CHasSuffixFromFileSign::Value( const CToken& token ) const
+void CSignValues::Reset( const CTokens& tokens, size_t begin, size_t end,
+	size_t _numberOfSigns )
 {
-	for( auto i = words.cbegin(); i != words.cend(); ++i ) {
-		const string& lex = token.Lex;
-		const string::size_type ll = lex.length(); // lex length
-		const string::size_type sl = i->length(); // suffix length
-		if( ll >= sl && lex.compare( ll - sl, sl, *i ) ) {
-			return BinarySignTrue;
-		}
-	}
-	return BinarySignFalse;
+	rows.Reset( tokens, begin, end );
+	numberOfSigns = _numberOfSigns;
+	values.resize( rows.Size() * numberOfSigns );
+}
+
+void CSignValues::Reset( const vector<size_t>& _rows, size_t _numberOfSigns )
+{
+	rows.Reset( _rows );
+	numberOfSigns = _numberOfSigns;
+	values.resize( rows.Size() * numberOfSigns );
 }
 
 //-----------------------------------------------------------------------------
-// CHasRootFromFileSign
+// CLexSignsCache
 
-class CHasRootFromFileSign : public CFileSign {
+// Values of the signs depending on lex packed by lexes. The cache is thread
+// safe and is shared by all documents of a run. Its size is bounded,
+// entries of a full shard are replaced by the CLOCK policy: the hand skips
+// (and clears the flag of) the entries found since it passed them.
+class CLexSignsCache {
 public:
-	CHasRootFromFileSign( const string& fileName ) :
-		CFileSign( fileName )
-	{
-	}
+	// each sign takes as many bits as its number of values needs
+	typedef uint64_t TPackedValues;
+	static const size_t PackedValuesBits = 64;
+	static const size_t DefaultMaxSize = 128 * 1024;
+
+	explicit CLexSignsCache( size_t maxSize = DefaultMaxSize );
+
+	// isWord is IsWord( type ) of the token of the lex
+	bool Find( const CStringRef& lex, bool isWord, TPackedValues& values );
+	void Insert( const CStringRef& lex, bool isWord, TPackedValues values );
 
-	virtual string Value( const CToken& token ) const;
+	uint64_t NumberOfHits() const { return numberOfHits; }
+	uint64_t NumberOfMisses() const { return numberOfMisses; }
+
+private:
+	static const size_t NumberOfShards = 16;
+
+	struct CKey {
+		CStringRef Lex;
+		bool IsWord;
+
+		bool operator==( const CKey& other ) const
+			{ return ( IsWord == other.IsWord && Lex == other.Lex ); }
+	};
+
+	struct CKeyHash {
+		size_t operator()( const CKey& key ) const
+			{ return ( CStringRefHash()( key.Lex ) * 2 + ( key.IsWord ? 1 : 0 ) ); }
+	};
+
+	struct CEntry {
+		string Lex;
+		bool IsWord;
+		bool IsReferenced;
+		TPackedValues Values;
+	};
+
+	struct CShard {
+		mutex Mutex;
+		// deque doesn't move entries, so keys of index refer to their lexes
+		deque<CEntry> Entries;
+		unordered_map<CKey, size_t, CKeyHash> Index;
+		size_t Hand;
+
+		CShard() : Hand( 0 ) {}
+		size_t Evict();
+	};
+
+	size_t maxShardSize;
+	CShard shards[NumberOfShards];
+	atomic<uint64_t> numberOfHits;
+	atomic<uint64_t> numberOfMisses;
+
+	CShard& shard( const CKey& key )
+		{ return shards[CKeyHash()( key ) % NumberOfShards]; }
+
+	CLexSignsCache( const CLexSignsCache& );
+	CLexSignsCache& operator=( const CLexSignsCache& );
 };
 
-string CHasRootFromFileSign::Value( const CToken& token ) const
+CLexSignsCache::CLexSignsCache( size_t maxSize ) :
+	maxShardSize( max<size_t>( maxSize / NumberOfShards, 1 ) ),
+	numberOfHits( 0 ),
+	numberOfMisses( 0 )
 {
-	int numberOfRootOccurencies = 0;
-	for( auto i = words.cbegin(); i != words.cend(); ++i ) {
-		if( token.Lex.find( *i ) != string::npos ) {
-			numberOfRootOccurencies++;
-			if( numberOfRootOccurencies >= 2 ) {
-				break;
-			}
+}
+
+bool CLexSignsCache::Find( const CStringRef& lex, bool isWord,
+	TPackedValues& values )
+{
+	const CKey key = { lex, isWord };
+	CShard& keyShard = shard( key );
+	{
+		lock_guard<mutex> lock( keyShard.Mutex );
+		auto i = keyShard.Index.find( key );
+		if( i != keyShard.Index.end() ) {
+			CEntry& entry = keyShard.Entries[i->second];
+			entry.IsReferenced = true;
+			values = entry.Values;
+			numberOfHits++;
+			return true;
 		}
 	}
-	assert( numberOfRootOccurencies <= 2 );
-	if( numberOfRootOccurencies == 1 ) {
-		return "R1";
-	} else if( numberOfRootOccurencies == 2 ) {
-		return "R2+";
+	numberOfMisses++;
+	return false;
+}
+
+void CLexSignsCache::Insert( const CStringRef& lex, bool isWord,
+	TPackedValues values )
+{
+	const CKey key = { lex, isWord };
+	CShard& keyShard = shard( key );
+	lock_guard<mutex> lock( keyShard.Mutex );
+	auto i = keyShard.Index.find( key );
+	if( i != keyShard.Index.end() ) {
+		// is inserted by another thread
+		keyShard.Entries[i->second].Values = values;
+		return;
+	}
+	size_t index = keyShard.Entries.size();
+	if( index < maxShardSize ) {
+		keyShard.Entries.push_back( CEntry() );
+	} else {
+		index = keyShard.Evict();
+	}
+	CEntry& entry = keyShard.Entries[index];
+	entry.Lex.assign( lex.Data(), lex.Length() );
+	entry.IsWord = isWord;
+	entry.IsReferenced = false;
+	entry.Values = values;
+	const CKey entryKey = {
+		CStringRef( entry.Lex.data(), entry.Lex.length() ), isWord };
+	keyShard.Index.insert( make_pair( entryKey, index ) );
+}
+
+// returns the index of the entry removed from the index
+size_t CLexSignsCache::CShard::Evict()
+{
+	while( Entries[Hand].IsReferenced ) {
+		Entries[Hand].IsReferenced = false;
+		Hand = ( Hand + 1 ) % Entries.size();
 	}
-	return "R0";
+	const size_t index = Hand;
+	Hand = ( Hand + 1 ) % Entries.size();
+	const CEntry& entry = Entries[index];
+	const CKey key = {
+		CStringRef( entry.Lex.data(), entry.Lex.length() ), entry.IsWord };
+	Index.erase( key );
+	return index;
 }
 
 //-----------------------------------------------------------------------------
+// CBaseSigns
 
-void InitializeSigns( CSigns& signs, const string& auxFilesPath )
+// All the signs of a token, they make a line of CRF++ input
+class CBaseSigns {
+public:
+	CBaseSigns() {}
+	virtual ~CBaseSigns() {}
+
+	virtual size_t Size() const = 0;
+	// evaluates signs of tokens [begin, end) sign by sign
+	void Evaluate( const CTokens& tokens, size_t begin, size_t end,
+		CSignValues& values ) const;
+	// appends a line of texts of values of signs of the row
+	virtual void AppendText( const CSignValues& values, size_t row,
+		const CStringPool& strings, string& text ) const = 0;
+
+	// only used signs are evaluated, texts of values of unused signs
+	// are UnusedSignValueText (all signs are used by default)
+	void SetUsedSigns( const vector<bool>& isUsed );
+	bool IsUsed( size_t index ) const
+		{ return ( isUsed.empty() || isUsed[index] ); }
+
+	// values of the signs depending on lex are cached for all
+	// evaluations, the cache is enabled after all signs are added
+	void EnableLexCache( size_t maxSize = CLexSignsCache::DefaultMaxSize );
+	// nullptr if the cache is not enabled
+	const CLexSignsCache* LexCache() const { return lexCache.get(); }
+
+protected:
+	// which signs are evaluated by evaluateColumns
+	enum TSignsFilter {
+		SF_All,
+		SF_DependOnLex,
+		SF_DoNotDependOnLex
+	};
+
+	static const CStringRef UnusedSignValueText;
+
+	// DependsOnLex() and NumberOfValues() of each sign,
+	// filled by derived classes
+	vector<bool> dependsOnLex;
+	vector<size_t> numberOfValues;
+
+	bool isSelected( size_t index, TSignsFilter filter ) const;
+	virtual void evaluateColumns( const CTokens& tokens,
+		CSignValues& values, TSignsFilter filter ) const = 0;
+	static void appendValueText( size_t index, const CStringRef& valueText,
+		string& text );
+
+private:
+	vector<bool> isUsed;
+	// cached signs, offsets and masks of their values in packed values
+	vector<size_t> lexSigns;
+	vector<size_t> lexSignsShifts;
+	vector<CLexSignsCache::TPackedValues> lexSignsMasks;
+	unique_ptr<CLexSignsCache> lexCache;
+
+	void evaluateLexSigns( const CTokens& tokens, CSignValues& values ) const;
+
+	CBaseSigns( const CBaseSigns& );
+	CBaseSigns& operator=( const CBaseSigns& );
+};
+
+void CBaseSigns::Evaluate( const CTokens& tokens, size_t begin, size_t end,
+	CSignValues& values ) const
+{
+	values.Reset( tokens, begin, end, Size() );
+	if( !lexCache ) {
+		evaluateColumns( tokens, values, SF_All );
+		return;
+	}
+	evaluateColumns( tokens, values, SF_DoNotDependOnLex );
+	evaluateLexSigns( tokens, values );
+}
+
+const CStringRef CBaseSigns::UnusedSignValueText( "_", 1 );
+
+void CBaseSigns::SetUsedSigns( const vector<bool>& _isUsed )
+{
+	assert( _isUsed.size() == Size() );
+	// cached signs are chosen by EnableLexCache
+	assert( lexCache == nullptr );
+	isUsed = _isUsed;
+}
+
+void CBaseSigns::EnableLexCache( size_t maxSize )
+{
+	assert( dependsOnLex.size() == Size() );
+	assert( numberOfValues.size() == Size() );
+	lexSigns.clear();
+	lexSignsShifts.clear();
+	lexSignsMasks.clear();
+	lexCache.reset();
+	size_t shift = 0;
+	for( size_t i = 0; i < dependsOnLex.size(); i++ ) {
+		if( !dependsOnLex[i] || !IsUsed( i ) ) {
+			continue;
+		}
+		if( numberOfValues[i] == 0 ) {
+			return;
+		}
+		size_t bits = 1;
+		while( bits < CLexSignsCache::PackedValuesBits
+			&& ( numberOfValues[i] - 1 ) >> bits != 0 )
+		{
+			bits++;
+		}
+		if( shift + bits > CLexSignsCache::PackedValuesBits ) {
+			// values of the signs don't fit
+			return;
+		}
+		lexSigns.push_back( i );
+		lexSignsShifts.push_back( shift );
+		lexSignsMasks.push_back( bits == CLexSignsCache::PackedValuesBits ?
+			~CLexSignsCache::TPackedValues( 0 ) :
+			( CLexSignsCache::TPackedValues( 1 ) << bits ) - 1 );
+		shift += bits;
+	}
+	if( !lexSigns.empty() ) {
+		lexCache.reset( new CLexSignsCache( maxSize ) );
+	}
+}
+
+bool CBaseSigns::isSelected( size_t index, TSignsFilter filter ) const
+{
+	if( !IsUsed( index ) ) {
+		return false;
+	}
+	switch( filter ) {
+		case SF_All:
+			return true;
+		case SF_DependOnLex:
+			return dependsOnLex[index];
+		case SF_DoNotDependOnLex:
+			return !dependsOnLex[index];
+	}
+	assert( false );
+	return false;
+}
+
+// rows of a lex (by its id in the string pool of tokens) are looked up in
+// the cache once, values of cached lexes are copied from the cache and
+// one row of each of the rest lexes is evaluated
+void CBaseSigns::evaluateLexSigns( const CTokens& tokens,
+	CSignValues& values ) const
+{
+	// ( lex id and IsWord flag, row ) sorted by lexes
+	vector<pair<uint64_t, size_t> > lexRows;
+	lexRows.reserve( values.NumberOfRows() );
+	for( size_t row = 0; row < values.NumberOfRows(); row++ ) {
+		const size_t token = values.Rows()[row];
+		lexRows.push_back( make_pair(
+			static_cast<uint64_t>( tokens.LexId( token ) ) * 2
+				+ ( IsWord( tokens.Type( token ) ) ? 1 : 0 ), row ) );
+	}
+	sort( lexRows.begin(), lexRows.end() );
+
+	// ranges of lexRows of the lexes which are not in the cache
+	vector<pair<size_t, size_t> > missedLexes;
+	vector<size_t> missedTokens;
+	for( size_t begin = 0; begin < lexRows.size(); ) {
+		size_t end = begin + 1;
+		while( end < lexRows.size() && lexRows[end].first == lexRows[begin].first ) {
+			end++;
+		}
+		const size_t token = values.Rows()[lexRows[begin].second];
+		CLexSignsCache::TPackedValues packedValues;
+		if( lexCache->Find( tokens.Lex( token ), IsWord( tokens.Type( token ) ),
+			packedValues ) )
+		{
+			for( size_t i = 0; i < lexSigns.size(); i++ ) {
+				const TSignValue value = static_cast<TSignValue>(
+					( packedValues >> lexSignsShifts[i] ) & lexSignsMasks[i] );
+				TSignValue* column = values.Column( lexSigns[i] );
+				for( size_t row = begin; row < end; row++ ) {
+					column[lexRows[row].second] = value;
+				}
+			}
+		} else {
+			missedLexes.push_back( make_pair( begin, end ) );
+			missedTokens.push_back( token );
+		}
+		begin = end;
+	}
+	if( missedLexes.empty() ) {
+		return;
+	}
+
+	CSignValues missedValues;
+	missedValues.Reset( missedTokens, Size() );
+	evaluateColumns( tokens, missedValues, SF_DependOnLex );
+	for( size_t missed = 0; missed < missedLexes.size(); missed++ ) {
+		CLexSignsCache::TPackedValues packedValues = 0;
+		for( size_t i = 0; i < lexSigns.size(); i++ ) {
+			const TSignValue value = missedValues.Value( missed, lexSigns[i] );
+			TSignValue* column = values.Column( lexSigns[i] );
+			for( size_t row = missedLexes[missed].first;
+				row < missedLexes[missed].second; row++ )
+			{
+				column[lexRows[row].second] = value;
+			}
+			assert( value < numberOfValues[lexSigns[i]] );
+			packedValues |= static_cast<CLexSignsCache::TPackedValues>( value )
+				<< lexSignsShifts[i];
+		}
+		const size_t token = missedTokens[missed];
+		lexCache->Insert( tokens.Lex( token ), IsWord( tokens.Type( token ) ),
+			packedValues );
+	}
+}
+
+void CBaseSigns::appendValueText( size_t index, const CStringRef& valueText,
+	string& text )
+{
+	assert( !valueText.IsEmpty() );
+	if( index > 0 ) {
+		text += '\t';
+	}
+	text.append( valueText.Data(), valueText.Length() );
+}
+
+//-----------------------------------------------------------------------------
+// CSigns
+
+// Signs of tokens which are set up at run time (see InitializeSigns)
+class CSigns : public CBaseSigns {
+public:
+	void Clear();
+	void AddSign( CBaseSign* sign );
+	const shared_ptr<CBaseSign>& Sign( size_t index ) const
+		{ return signs[index]; }
+
+	virtual size_t Size() const { return signs.size(); }
+	virtual void AppendText( const CSignValues& values, size_t row,
+		const CStringPool& strings, string& text ) const;
+
+protected:
+	virtual void evaluateColumns( const CTokens& tokens,
+		CSignValues& values, TSignsFilter filter ) const;
+
+private:
+	vector<shared_ptr<CBaseSign> > signs;
+};
+
+void CSigns::Clear()
 {
 	signs.clear();
+	dependsOnLex.clear();
+	numberOfValues.clear();
+}
 
-	//  (  )
-	signs.AddSign( new CTextSign() );
+void CSigns::AddSign( CBaseSign* sign )
+{
+	assert( LexCache() == nullptr );
+	signs.push_back( shared_ptr<CBaseSign>( sign ) );
+	dependsOnLex.push_back( sign->DependsOnLex() );
+	numberOfValues.push_back( sign->NumberOfValues() );
+}
 
-	//  (   mystem)
-	signs.AddSign( new CLexSign() );
+void CSigns::AppendText( const CSignValues& values, size_t row,
+	const CStringPool& strings, string& text ) const
+{
+	for( size_t i = 0; i < signs.size(); i++ ) {
+		if( IsUsed( i ) ) {
+			appendValueText( i,
+				signs[i]->ValueText( values.Value( row, i ), strings ), text );
+		} else {
+			appendValueText( i, UnusedSignValueText, text );
+		}
+	}
+	text += '\n';
+}
 
-	//  (BigBig/BigSmall/SmallSmall/Fence)
-	signs.AddSign( new CRegisterSign() );
+void CSigns::evaluateColumns( const CTokens& tokens,
+	CSignValues& values, TSignsFilter filter ) const
+{
+	for( size_t i = 0; i < signs.size(); i++ ) {
+		if( isSelected( i, filter ) ) {
+			signs[i]->EvaluateColumn( tokens, values.Rows(),
+				values.Column( i ) );
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// CTextSign
+
+class CTextSign : public CBaseSign {
+public:
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+	virtual size_t NumberOfValues() const { return 0; }
+	virtual const CStringRef& ValueText( TSignValue value,
+		const CStringPool& strings ) const;
+};
+
+TSignValue CTextSign::Value( const CToken& token ) const
+{
+	assert( IsWordOrMark( token.Type ) );
+	return token.TextId;
+}
+
+void CTextSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = tokens.TextId( rows[i] );
+	}
+}
+
+const CStringRef& CTextSign::ValueText( TSignValue value,
+	const CStringPool& strings ) const
+{
+	return strings.String( value );
+}
+
+//-----------------------------------------------------------------------------
+// CLexSign
+
+class CLexSign : public CBaseSign {
+public:
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+	virtual size_t NumberOfValues() const { return 0; }
+	virtual const CStringRef& ValueText( TSignValue value,
+		const CStringPool& strings ) const;
+};
+
+TSignValue CLexSign::Value( const CToken& token ) const
+{
+	assert( IsWordOrMark( token.Type ) );
+	return token.LexId;
+}
+
+void CLexSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = tokens.LexId( rows[i] );
+	}
+}
+
+const CStringRef& CLexSign::ValueText( TSignValue value,
+	const CStringPool& strings ) const
+{
+	return strings.String( value );
+}
+
+//-----------------------------------------------------------------------------
+// CNamedEntityTypeSign
+
+class CNamedEntityTypeSign : public CBaseSign {
+public:
+	CNamedEntityTypeSign() : CBaseSign( NamedEntityTypesText ) {}
+
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+};
+
+TSignValue CNamedEntityTypeSign::Value( const CToken& token ) const
+{
+	assert( IsWordOrMark( token.Type ) );
+	return token.NamedEntityType;
+}
+
+void CNamedEntityTypeSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = tokens.NamedEntityType( rows[i] );
+	}
+}
+
+//-----------------------------------------------------------------------------
+// CRegisterSign
+
+class CRegisterSign : public CBaseSign {
+public:
+	CRegisterSign() : CBaseSign( Values ) {}
+
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+
+private:
+	enum TValue {
+		V_No,
+		V_BigBig,
+		V_BigSmall,
+		V_Small,
+		V_Fence
+	};
+	static const char* const Values[5];
+
+	static TSignValue value( TTokenType type, TTokenShape shape );
+};
+
+const char* const CRegisterSign::Values[5] = {
+	"NO", "BigBig", "BigSmall", "Small", "Fence"
+};
+
+TSignValue CRegisterSign::Value( const CToken& token ) const
+{
+	return value( token.Type, token.Shape );
+}
+
+void CRegisterSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = value( tokens.Type( rows[i] ), tokens.Shape( rows[i] ) );
+	}
+}
+
+TSignValue CRegisterSign::value( TTokenType type, TTokenShape shape )
+{
+	assert( IsWordOrMark( type ) );
+	if( IsWord( type ) ) {
+		const bool isFirstLetterInUppercase = ( shape & TSF_FirstUpper ) != 0;
+		if( isFirstLetterInUppercase && ( shape & TSF_RestUpper ) != 0 ) {
+			return V_BigBig;
+		} else if( isFirstLetterInUppercase && ( shape & TSF_RestLower ) != 0 ) {
+			return V_BigSmall;
+		} else if( !isFirstLetterInUppercase && ( shape & TSF_RestLower ) != 0 ) {
+			return V_Small;
+		}
+		return V_Fence;
+	}
+	return V_No;
+}
+
+//-----------------------------------------------------------------------------
+// CHasVowelLetterSign
+
+class CHasVowelLetterSign : public CBaseSign {
+public:
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+
+private:
+	static TSignValue value( TTokenType type, TTokenShape shape );
+};
+
+TSignValue CHasVowelLetterSign::Value( const CToken& token ) const
+{
+	return value( token.Type, token.Shape );
+}
+
+void CHasVowelLetterSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = value( tokens.Type( rows[i] ), tokens.Shape( rows[i] ) );
+	}
+}
+
+TSignValue CHasVowelLetterSign::value( TTokenType type, TTokenShape shape )
+{
+	assert( IsWordOrMark( type ) );
+	if( IsWord( type ) && ( shape & TSF_HasVowel ) != 0 ) {
+		return BinarySignTrue;
+	}
+	return BinarySignFalse;
+}
+
+//-----------------------------------------------------------------------------
+// CTextLengthSign
+
+class CTextLengthSign : public CBaseSign {
+public:
+	CTextLengthSign() : CBaseSign( Values ) {}
+
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+
+private:
+	// TTokenShapeLength
+	static const char* const Values[3];
+
+	static TSignValue value( TTokenType type, TTokenShape shape );
+};
+
+const char* const CTextLengthSign::Values[3] = { "L1", "L2-4", "L5+" };
+
+TSignValue CTextLengthSign::Value( const CToken& token ) const
+{
+	return value( token.Type, token.Shape );
+}
+
+void CTextLengthSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = value( tokens.Type( rows[i] ), tokens.Shape( rows[i] ) );
+	}
+}
+
+TSignValue CTextLengthSign::value( TTokenType type, TTokenShape shape )
+{
+	assert( IsWordOrMark( type ) );
+	if( IsMark( type ) ) {
+		return TSL_1;
+	}
+	return GetShapeLength( shape );
+}
+
+//-----------------------------------------------------------------------------
+// CTokenTypeSign
+
+class CTokenTypeSign : public CBaseSign {
+public:
+	CTokenTypeSign() : CBaseSign( TokenTypesText ) {}
+
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+};
+
+TSignValue CTokenTypeSign::Value( const CToken& token ) const
+{
+	assert( IsWordOrMark( token.Type ) );
+	return token.Type;
+}
+
+void CTokenTypeSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = tokens.Type( rows[i] );
+	}
+}
+
+//-----------------------------------------------------------------------------
+// CIsEndOfSentenceSign
+
+class CIsEndOfSentenceSign : public CBaseSign {
+public:
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+};
+
+TSignValue CIsEndOfSentenceSign::Value( const CToken& token ) const
+{
+	assert( IsWordOrMark( token.Type ) );
+	if( token.IsEndOfSentence ) {
+		return BinarySignTrue;
+	}
+	return BinarySignFalse;
+}
+
+void CIsEndOfSentenceSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = tokens.IsEndOfSentence( rows[i] ) ?
+			BinarySignTrue : BinarySignFalse;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// CAhoCorasick
+
+// Aho-Corasick automaton of a set of patterns. Transitions of states are
+// resolved for all symbols (by failure links), so the text is matched in
+// one pass by one table lookup per byte. Bytes not used in patterns are
+// one symbol, so rows of the transition table are short.
+class CAhoCorasick {
+public:
+	// max value of maxCount of CountPatterns
+	static const size_t MaxCount = 8;
+
+	CAhoCorasick();
+
+	void Build( const vector<string>& patterns );
+	size_t NumberOfStates() const { return numberOfStates; }
+	// number of different patterns occurring in the text,
+	// counting stops at maxCount
+	size_t CountPatterns( const CStringRef& text, size_t maxCount ) const;
+
+private:
+	typedef uint32_t TState;
+	static const TState RootState = 0;
+	// all 256 bytes and symbol 0 of the unused bytes
+	typedef uint16_t TSymbol;
+
+	TSymbol symbols[256];
+	size_t alphabetSize;
+	size_t numberOfStates;
+	// alphabetSize transitions of each state
+	vector<TState> transitions;
+	// patterns ending in state S (with the ones of its failure links)
+	// are outputs[outputsBegin[S]..outputsBegin[S + 1])
+	vector<uint32_t> outputsBegin;
+	vector<uint32_t> outputs;
+
+	TState& transition( TState state, size_t symbol )
+		{ return transitions[state * alphabetSize + symbol]; }
+	TState transition( TState state, size_t symbol ) const
+		{ return transitions[state * alphabetSize + symbol]; }
+};
+
+const CAhoCorasick::TState CAhoCorasick::RootState;
+
+CAhoCorasick::CAhoCorasick() :
+	alphabetSize( 1 ),
+	numberOfStates( 1 ),
+	transitions( 1, RootState ),
+	outputsBegin( 2, 0 )
+{
+	memset( symbols, 0, sizeof( symbols ) );
+}
+
+void CAhoCorasick::Build( const vector<string>& patterns )
+{
+	// symbol 0 is any byte which is not used in patterns
+	memset( symbols, 0, sizeof( symbols ) );
+	alphabetSize = 1;
+	for( auto i = patterns.cbegin(); i != patterns.cend(); ++i ) {
+		for( auto c = i->cbegin(); c != i->cend(); ++c ) {
+			TSymbol& symbol = symbols[static_cast<unsigned char>( *c )];
+			if( symbol == 0 ) {
+				symbol = static_cast<TSymbol>( alphabetSize++ );
+			}
+		}
+	}
+	assert( alphabetSize <= 257 );
+
+	// trie of patterns, RootState is the absent transition
+	numberOfStates = 1;
+	transitions.assign( alphabetSize, RootState );
+	vector<vector<uint32_t> > stateOutputs( 1 );
+	for( size_t i = 0; i < patterns.size(); i++ ) {
+		assert( !patterns[i].empty() );
+		TState state = RootState;
+		for( auto c = patterns[i].cbegin(); c != patterns[i].cend(); ++c ) {
+			const TSymbol symbol = symbols[static_cast<unsigned char>( *c )];
+			if( transition( state, symbol ) == RootState ) {
+				transition( state, symbol ) =
+					static_cast<TState>( numberOfStates++ );
+				transitions.resize( numberOfStates * alphabetSize, RootState );
+				stateOutputs.push_back( vector<uint32_t>() );
+			}
+			state = transition( state, symbol );
+		}
+		stateOutputs[state].push_back( static_cast<uint32_t>( i ) );
+	}
+
+	// breadth first resolving of transitions by failure links,
+	// a row of a state has only trie transitions until it is resolved
+	vector<TState> failures( numberOfStates, RootState );
+	deque<TState> queue;
+	for( size_t symbol = 0; symbol < alphabetSize; symbol++ ) {
+		if( transition( RootState, symbol ) != RootState ) {
+			queue.push_back( transition( RootState, symbol ) );
+		}
+	}
+	while( !queue.empty() ) {
+		const TState state = queue.front();
+		queue.pop_front();
+		const vector<uint32_t>& failureOutputs = stateOutputs[failures[state]];
+		stateOutputs[state].insert( stateOutputs[state].end(),
+			failureOutputs.cbegin(), failureOutputs.cend() );
+		for( size_t symbol = 0; symbol < alphabetSize; symbol++ ) {
+			const TState failureNext = transition( failures[state], symbol );
+			TState& next = transition( state, symbol );
+			if( next != RootState ) {
+				failures[next] = failureNext;
+				queue.push_back( next );
+			} else {
+				next = failureNext;
+			}
+		}
+	}
+
+	outputsBegin.clear();
+	outputs.clear();
+	for( size_t state = 0; state < numberOfStates; state++ ) {
+		outputsBegin.push_back( static_cast<uint32_t>( outputs.size() ) );
+		outputs.insert( outputs.end(), stateOutputs[state].cbegin(),
+			stateOutputs[state].cend() );
+	}
+	outputsBegin.push_back( static_cast<uint32_t>( outputs.size() ) );
+}
+
+size_t CAhoCorasick::CountPatterns( const CStringRef& text,
+	size_t maxCount ) const
+{
+	assert( maxCount <= MaxCount );
+	uint32_t found[MaxCount];
+	size_t count = 0;
+	TState state = RootState;
+	for( size_t i = 0; i < text.Length() && count < maxCount; i++ ) {
+		state = transition( state,
+			symbols[static_cast<unsigned char>( text[i] )] );
+		for( uint32_t output = outputsBegin[state];
+			output < outputsBegin[state + 1] && count < maxCount; output++ )
+		{
+			const uint32_t pattern = outputs[output];
+			if( find( found, found + count, pattern ) == found + count ) {
+				found[count++] = pattern;
+			}
+		}
+	}
+	return count;
+}
+
+//-----------------------------------------------------------------------------
+// CTrie
+
+// Trie of keys in flat arrays, edges of a node are adjacent and sorted
+// by symbols. Sequences are walked by iterators, so a trie of reversed
+// keys is walked by reverse iterators.
+class CTrie {
+public:
+	static const uint32_t NoKey = UINT32_MAX;
+
+	CTrie() { Build( vector<string>() ); }
+
+	// ids of keys are their indices, keys are different and not empty
+	void Build( const vector<string>& keys );
+	// id of the longest key which is a prefix of [begin, end) or NoKey,
+	// numberOfKeys is set to the number of keys which are its prefixes
+	template<typename TIterator>
+	uint32_t FindLongestKey( TIterator begin, TIterator end,
+		size_t* numberOfKeys = nullptr ) const;
+
+private:
+	struct CNode {
+		uint32_t EdgesBegin;
+		uint32_t EdgesEnd;
+		uint32_t Key;
+	};
+
+	struct CEdge {
+		unsigned char Symbol;
+		uint32_t Node;
+	};
+
+	vector<CNode> nodes;
+	vector<CEdge> edges;
+
+	uint32_t build( const vector<string>& keys, const vector<uint32_t>& order,
+		size_t begin, size_t end, size_t depth );
+};
+
+const uint32_t CTrie::NoKey;
+
+void CTrie::Build( const vector<string>& keys )
+{
+	vector<uint32_t> order;
+	for( size_t i = 0; i < keys.size(); i++ ) {
+		assert( !keys[i].empty() );
+		order.push_back( static_cast<uint32_t>( i ) );
+	}
+	sort( order.begin(), order.end(), [&keys]( uint32_t a, uint32_t b ) {
+		return ( keys[a] < keys[b] );
+	} );
+	nodes.clear();
+	edges.clear();
+	build( keys, order, 0, order.size(), 0 );
+}
+
+template<typename TIterator>
+uint32_t CTrie::FindLongestKey( TIterator begin, TIterator end,
+	size_t* numberOfKeys ) const
+{
+	uint32_t key = nodes[0].Key;
+	size_t count = 0;
+	uint32_t node = 0;
+	for( TIterator i = begin; i != end; ++i ) {
+		const unsigned char symbol = static_cast<unsigned char>( *i );
+		const CEdge* edge = edges.data() + nodes[node].EdgesBegin;
+		const CEdge* edgesEnd = edges.data() + nodes[node].EdgesEnd;
+		for( ; edge != edgesEnd && edge->Symbol < symbol; ++edge ) {
+		}
+		if( edge == edgesEnd || edge->Symbol != symbol ) {
+			break;
+		}
+		node = edge->Node;
+		if( nodes[node].Key != NoKey ) {
+			key = nodes[node].Key;
+			count++;
+		}
+	}
+	if( numberOfKeys != nullptr ) {
+		*numberOfKeys = count;
+	}
+	return key;
+}
+
+// builds the node of sorted keys order[begin, end) with the same
+// first depth symbols, edges of the node precede edges of its children
+uint32_t CTrie::build( const vector<string>& keys,
+	const vector<uint32_t>& order, size_t begin, size_t end, size_t depth )
+{
+	const uint32_t node = static_cast<uint32_t>( nodes.size() );
+	nodes.push_back( CNode() );
+	nodes[node].Key = NoKey;
+	if( begin < end && keys[order[begin]].length() == depth ) {
+		nodes[node].Key = order[begin];
+		begin++;
+	}
+	// children are groups of keys with the same symbol at depth
+	vector<size_t> groups;
+	for( size_t i = begin; i < end; i++ ) {
+		if( i == begin
+			|| keys[order[i]][depth] != keys[order[i - 1]][depth] )
+		{
+			groups.push_back( i );
+		}
+	}
+	groups.push_back( end );
+	nodes[node].EdgesBegin = static_cast<uint32_t>( edges.size() );
+	nodes[node].EdgesEnd =
+		static_cast<uint32_t>( edges.size() + groups.size() - 1 );
+	edges.resize( nodes[node].EdgesEnd );
+	for( size_t i = 0; i + 1 < groups.size(); i++ ) {
+		const uint32_t child =
+			build( keys, order, groups[i], groups[i + 1], depth + 1 );
+		CEdge& edge = edges[nodes[node].EdgesBegin + i];
+		edge.Symbol = static_cast<unsigned char>( keys[order[groups[i]]][depth] );
+		edge.Node = child;
+	}
+	return node;
+}
+
+//-----------------------------------------------------------------------------
+// CFileSign
+
+// name is the name of a list of words of CAuxFiles
+class CFileSign : public CBaseSign {
+public:
+	CFileSign( const CAuxFiles& auxFiles, const string& name );
+	template<size_t ValuesSize>
+	CFileSign( const CAuxFiles& auxFiles, const string& name,
+		const char* const ( &values )[ValuesSize] );
+
+protected:
+	unordered_set<string> words;
+};
+
+CFileSign::CFileSign( const CAuxFiles& auxFiles, const string& name )
+{
+	auxFiles.ReadWords( name, words );
+}
+
+template<size_t ValuesSize>
+CFileSign::CFileSign( const CAuxFiles& auxFiles, const string& name,
+		const char* const ( &values )[ValuesSize] ) :
+	CBaseSign( values )
+{
+	auxFiles.ReadWords( name, words );
+}
+
+//-----------------------------------------------------------------------------
+// CLexFromFileSign
+
+// The list of the file is one of the gazetteers shared by signs,
+// so a lex is looked up once for all the lists
+class CLexFromFileSign : public CBaseSign {
+public:
+	CLexFromFileSign( const shared_ptr<CGazetteers>& gazetteers,
+		const string& name );
+
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+	virtual bool DependsOnLex() const { return true; }
+
+private:
+	shared_ptr<CGazetteers> gazetteers;
+	size_t list;
+
+	static TSignValue value( TTokenType type, uint32_t lexMask,
+		uint32_t listMask );
+};
+
+CLexFromFileSign::CLexFromFileSign(
+		const shared_ptr<CGazetteers>& _gazetteers, const string& name ) :
+	gazetteers( _gazetteers ),
+	list( gazetteers->AddList( name ) )
+{
+}
+
+TSignValue CLexFromFileSign::Value( const CToken& token ) const
+{
+	return value( token.Type, gazetteers->Mask( token.Lex ),
+		gazetteers->ListMask( list ) );
+}
+
+void CLexFromFileSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	const vector<uint32_t>& masks =
+		rows.GazetteersMasks( tokens, *gazetteers );
+	const uint32_t listMask = gazetteers->ListMask( list );
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = value( tokens.Type( rows[i] ), masks[i], listMask );
+	}
+}
+
+TSignValue CLexFromFileSign::value( TTokenType type, uint32_t lexMask,
+	uint32_t listMask )
+{
+	assert( IsWordOrMark( type ) );
+	if( IsWord( type ) && ( lexMask & listMask ) != 0 ) {
+		return BinarySignTrue;
+	}
+	return BinarySignFalse;
+}
+
+//-----------------------------------------------------------------------------
+// CPrefixFromFileSign
+
+// The longest prefix of the list which the lex begins with,
+// values are NO and the sorted prefixes (value is 1 + index of the prefix)
+class CPrefixFromFileSign : public CFileSign {
+public:
+	CPrefixFromFileSign( const CAuxFiles& auxFiles, const string& name );
+
+	// index of the longest prefix of the lex in Prefixes() or CTrie::NoKey
+	uint32_t FindLongestPrefix( const CStringRef& lex ) const;
+	// sorted prefixes of the list
+	const vector<string>& Prefixes() const { return prefixes; }
+
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+	virtual bool DependsOnLex() const { return true; }
+	virtual size_t NumberOfValues() const { return valuesText.size(); }
+	virtual const CStringRef& ValueText( TSignValue value,
+		const CStringPool& strings ) const;
+
+private:
+	vector<string> prefixes;
+	CTrie prefixesTrie;
+	// NO and the prefixes
+	vector<CStringRef> valuesText;
+
+	TSignValue value( const CStringRef& lex ) const;
+};
+
+CPrefixFromFileSign::CPrefixFromFileSign( const CAuxFiles& auxFiles,
+		const string& name ) :
+	CFileSign( auxFiles, name ),
+	prefixes( words.cbegin(), words.cend() )
+{
+	sort( prefixes.begin(), prefixes.end() );
+	prefixesTrie.Build( prefixes );
+	valuesText.push_back( CStringRef( BinarySignValues[BinarySignFalse],
+		strlen( BinarySignValues[BinarySignFalse] ) ) );
+	for( auto i = prefixes.cbegin(); i != prefixes.cend(); ++i ) {
+		valuesText.push_back( CStringRef( i->data(), i->length() ) );
+	}
+}
+
+uint32_t CPrefixFromFileSign::FindLongestPrefix( const CStringRef& lex ) const
+{
+	return prefixesTrie.FindLongestKey( lex.Data(),
+		lex.Data() + lex.Length() );
+}
+
+TSignValue CPrefixFromFileSign::Value( const CToken& token ) const
+{
+	return value( token.Lex );
+}
+
+void CPrefixFromFileSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = value( tokens.Lex( rows[i] ) );
+	}
+}
+
+const CStringRef& CPrefixFromFileSign::ValueText( TSignValue value,
+	const CStringPool& /* strings */ ) const
+{
+	assert( value < valuesText.size() );
+	return valuesText[value];
+}
+
+TSignValue CPrefixFromFileSign::value( const CStringRef& lex ) const
+{
+	const uint32_t prefix = FindLongestPrefix( lex );
+	if( prefix == CTrie::NoKey ) {
+		return BinarySignFalse;
+	}
+	return static_cast<TSignValue>( prefix + 1 );
+}
+
+//-----------------------------------------------------------------------------
+// CHasSuffixFromFileSign
+
+// YES if the list has a suffix, not longer than the lex, which the lex
+// does not end with (i.e. almost always). It is the column model.crf-model
+// is trained on, the ending itself is the value of CSuffixFromFileSign.
+class CHasSuffixFromFileSign : public CFileSign {
+public:
+	CHasSuffixFromFileSign( const CAuxFiles& auxFiles, const string& name );
+
+	// index of the longest suffix of the lex in Suffixes() or CTrie::NoKey,
+	// numberOfSuffixes is set to the number of suffixes of the lex
+	uint32_t FindLongestSuffix( const CStringRef& lex,
+		size_t* numberOfSuffixes = nullptr ) const;
+	// sorted suffixes of the list
+	const vector<string>& Suffixes() const { return suffixes; }
+
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+	virtual bool DependsOnLex() const { return true; }
+
+private:
+	vector<string> suffixes;
+	// trie of reversed suffixes
+	CTrie reversedSuffixes;
+	// numbers of suffixes not longer than the index
+	vector<size_t> numberOfShorterSuffixes;
+
+	TSignValue value( const CStringRef& lex ) const;
+};
+
+CHasSuffixFromFileSign::CHasSuffixFromFileSign( const CAuxFiles& auxFiles,
+		const string& name ) :
+	CFileSign( auxFiles, name ),
+	suffixes( words.cbegin(), words.cend() )
+{
+	sort( suffixes.begin(), suffixes.end() );
+	vector<string> reversed;
+	for( auto i = suffixes.cbegin(); i != suffixes.cend(); ++i ) {
+		reversed.push_back( string( i->rbegin(), i->rend() ) );
+		if( numberOfShorterSuffixes.size() <= i->length() ) {
+			numberOfShorterSuffixes.resize( i->length() + 1, 0 );
+		}
+		numberOfShorterSuffixes[i->length()]++;
+	}
+	reversedSuffixes.Build( reversed );
+	for( size_t i = 1; i < numberOfShorterSuffixes.size(); i++ ) {
+		numberOfShorterSuffixes[i] += numberOfShorterSuffixes[i - 1];
+	}
+}
+
+uint32_t CHasSuffixFromFileSign::FindLongestSuffix( const CStringRef& lex,
+	size_t* numberOfSuffixes ) const
+{
+	typedef reverse_iterator<const char*> TReverseIterator;
+	return reversedSuffixes.FindLongestKey(
+		TReverseIterator( lex.Data() + lex.Length() ),
+		TReverseIterator( lex.Data() ), numberOfSuffixes );
+}
+
+TSignValue CHasSuffixFromFileSign::Value( const CToken& token ) const
+{
+	return value( token.Lex );
+}
+
+void CHasSuffixFromFileSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = value( tokens.Lex( rows[i] ) );
+	}
+}
+
+TSignValue CHasSuffixFromFileSign::value( const CStringRef& lex ) const
+{
+	size_t numberOfSuffixes;
+	FindLongestSuffix( lex, &numberOfSuffixes );
+	const size_t length =
+		min( lex.Length(), numberOfShorterSuffixes.size() - 1 );
+	if( numberOfSuffixes < numberOfShorterSuffixes[length] ) {
+		return BinarySignTrue;
+	}
+	return BinarySignFalse;
+}
+
+//-----------------------------------------------------------------------------
+// CSuffixFromFileSign
+
+// The longest suffix of the list which the lex ends with,
+// values are NO and the sorted suffixes (value is 1 + index of the suffix)
+class CSuffixFromFileSign : public CHasSuffixFromFileSign {
+public:
+	CSuffixFromFileSign( const CAuxFiles& auxFiles, const string& name );
+
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+	virtual size_t NumberOfValues() const { return valuesText.size(); }
+	virtual const CStringRef& ValueText( TSignValue value,
+		const CStringPool& strings ) const;
+
+private:
+	// NO and the suffixes
+	vector<CStringRef> valuesText;
+
+	TSignValue value( const CStringRef& lex ) const;
+};
+
+CSuffixFromFileSign::CSuffixFromFileSign( const CAuxFiles& auxFiles,
+		const string& name ) :
+	CHasSuffixFromFileSign( auxFiles, name )
+{
+	valuesText.push_back( CStringRef( BinarySignValues[BinarySignFalse],
+		strlen( BinarySignValues[BinarySignFalse] ) ) );
+	for( auto i = Suffixes().cbegin(); i != Suffixes().cend(); ++i ) {
+		valuesText.push_back( CStringRef( i->data(), i->length() ) );
+	}
+}
+
+TSignValue CSuffixFromFileSign::Value( const CToken& token ) const
+{
+	return value( token.Lex );
+}
+
+void CSuffixFromFileSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = value( tokens.Lex( rows[i] ) );
+	}
+}
+
+const CStringRef& CSuffixFromFileSign::ValueText( TSignValue value,
+	const CStringPool& /* strings */ ) const
+{
+	assert( value < valuesText.size() );
+	return valuesText[value];
+}
+
+TSignValue CSuffixFromFileSign::value( const CStringRef& lex ) const
+{
+	const uint32_t suffix = FindLongestSuffix( lex );
+	if( suffix == CTrie::NoKey ) {
+		return BinarySignFalse;
+	}
+	return static_cast<TSignValue>( suffix + 1 );
+}
+
+//-----------------------------------------------------------------------------
+// CHasRootFromFileSign
+
+class CHasRootFromFileSign : public CFileSign {
+public:
+	CHasRootFromFileSign( const CAuxFiles& auxFiles, const string& name );
+
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+	virtual bool DependsOnLex() const { return true; }
+
+private:
+	// number of roots
+	static const char* const Values[3];
+
+	CAhoCorasick roots;
+
+	TSignValue value( const CStringRef& lex ) const;
+};
+
+const char* const CHasRootFromFileSign::Values[3] = { "R0", "R1", "R2+" };
+
+CHasRootFromFileSign::CHasRootFromFileSign( const CAuxFiles& auxFiles,
+		const string& name ) :
+	CFileSign( auxFiles, name, Values )
+{
+	roots.Build( vector<string>( words.cbegin(), words.cend() ) );
+}
+
+TSignValue CHasRootFromFileSign::Value( const CToken& token ) const
+{
+	return value( token.Lex );
+}
+
+void CHasRootFromFileSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		column[i] = value( tokens.Lex( rows[i] ) );
+	}
+}
+
+TSignValue CHasRootFromFileSign::value( const CStringRef& lex ) const
+{
+	return static_cast<TSignValue>( roots.CountPatterns( lex, 2 ) );
+}
+
+//-----------------------------------------------------------------------------
+// CPhraseMatcher
+
+// Aho-Corasick automaton of phrases, a phrase is a sequence of lexes.
+// Symbols of the automaton are ids of lexes of phrases and transitions
+// are in a hash table, so it is linear in length of the text for any
+// number of phrases.
+class CPhraseMatcher {
+public:
+	CPhraseMatcher();
+
+	// lexes of the phrase are separated by spaces
+	void AddPhrase( const string& phrase );
+	// is called after all phrases are added
+	void Build();
+	// number of rows of the longest phrase starting at each row
+	// (zero if there is no such phrase), phrases don't cross
+	// ends of sentences
+	void Match( const CTokens& tokens, const CSignRows& rows,
+		vector<uint32_t>& lengths ) const;
+
+private:
+	typedef uint32_t TState;
+	static const TState RootState = 0;
+
+	// deque doesn't move strings, so the pool refers to them
+	deque<string> lexesText;
+	CStringPool lexes;
+	unordered_map<uint64_t, TState> transitions;
+	// number of lexes of the path to a state
+	vector<uint32_t> depths;
+	vector<bool> isPhraseEnd;
+	vector<TState> failures;
+	// the nearest state ending a phrase by failure links
+	// (the state itself or RootState if there is no such state)
+	vector<TState> outputs;
+
+	static uint64_t transitionKey( TState state, TStringId lex )
+		{ return ( ( static_cast<uint64_t>( state ) << 32 ) | lex ); }
+	bool findTransition( TState state, TStringId lex, TState& next ) const;
+
+	CPhraseMatcher( const CPhraseMatcher& );
+	CPhraseMatcher& operator=( const CPhraseMatcher& );
+};
+
+const CPhraseMatcher::TState CPhraseMatcher::RootState;
+
+CPhraseMatcher::CPhraseMatcher() :
+	depths( 1, 0 ),
+	isPhraseEnd( 1, false )
+{
+}
+
+void CPhraseMatcher::AddPhrase( const string& phrase )
+{
+	TState state = RootState;
+	istringstream phraseStream( phrase );
+	string lex;
+	while( phraseStream >> lex ) {
+		TStringId lexId;
+		if( !lexes.Find( CStringRef( lex.data(), lex.length() ), lexId ) ) {
+			lexesText.push_back( lex );
+			lexId = lexes.Intern( CStringRef( lexesText.back().data(),
+				lexesText.back().length() ) );
+		}
+		TState next;
+		if( !findTransition( state, lexId, next ) ) {
+			next = static_cast<TState>( depths.size() );
+			transitions.insert( make_pair( transitionKey( state, lexId ), next ) );
+			depths.push_back( depths[state] + 1 );
+			isPhraseEnd.push_back( false );
+		}
+		state = next;
+	}
+	if( state != RootState ) {
+		isPhraseEnd[state] = true;
+	}
+}
+
+void CPhraseMatcher::Build()
+{
+	vector<vector<pair<TStringId, TState> > > children( depths.size() );
+	for( auto i = transitions.cbegin(); i != transitions.cend(); ++i ) {
+		children[i->first >> 32].push_back( make_pair(
+			static_cast<TStringId>( i->first & UINT32_MAX ), i->second ) );
+	}
+
+	// breadth first, failure links lead to less deep states
+	failures.assign( depths.size(), RootState );
+	outputs.assign( depths.size(), RootState );
+	deque<TState> queue( 1, RootState );
+	while( !queue.empty() ) {
+		const TState state = queue.front();
+		queue.pop_front();
+		for( auto child = children[state].cbegin();
+			child != children[state].cend(); ++child )
+		{
+			TState failure = RootState;
+			if( state != RootState ) {
+				failure = failures[state];
+				while( !findTransition( failure, child->first, failure )
+					&& failure != RootState )
+				{
+					failure = failures[failure];
+				}
+			}
+			const TState next = child->second;
+			failures[next] = failure;
+			outputs[next] = isPhraseEnd[next] ? next : outputs[failure];
+			queue.push_back( next );
+		}
+	}
+}
+
+void CPhraseMatcher::Match( const CTokens& tokens, const CSignRows& rows,
+	vector<uint32_t>& lengths ) const
+{
+	lengths.assign( rows.Size(), 0 );
+	TState state = RootState;
+	for( size_t row = 0; row < rows.Size(); row++ ) {
+		TStringId lex;
+		if( !lexes.Find( tokens.Lex( rows[row] ), lex ) ) {
+			state = RootState;
+			continue;
+		}
+		while( !findTransition( state, lex, state ) && state != RootState ) {
+			state = failures[state];
+		}
+		for( TState output = outputs[state]; output != RootState;
+			output = outputs[failures[output]] )
+		{
+			uint32_t& length = lengths[row + 1 - depths[output]];
+			length = max( length, depths[output] );
+		}
+		// so the signs of a span of whole sentences don't depend on
+		// the tokens around it (see SplitIntoChunks)
+		if( tokens.IsEndOfSentence( rows[row] ) ) {
+			state = RootState;
+		}
+	}
+}
+
+// next is not changed if there is no transition
+bool CPhraseMatcher::findTransition( TState state, TStringId lex,
+	TState& next ) const
+{
+	auto i = transitions.find( transitionKey( state, lex ) );
+	if( i == transitions.end() ) {
+		return false;
+	}
+	next = i->second;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// CPhraseFromFileSign
+
+// Phrases of the list (one per line, lexes are separated by spaces)
+// found in the text, the longest leftmost phrase is taken
+class CPhraseFromFileSign : public CBaseSign {
+public:
+	CPhraseFromFileSign( const CAuxFiles& auxFiles, const string& name );
+
+	// the sign depends on neighbours, so a single token is outside
+	virtual TSignValue Value( const CToken& token ) const;
+	virtual void EvaluateColumn( const CTokens& tokens,
+		const CSignRows& rows, TSignValue* column ) const;
+
+private:
+	enum TValue {
+		V_Outside,
+		V_Begin,
+		V_Inside
+	};
+	static const char* const Values[3];
+
+	CPhraseMatcher phrases;
+};
+
+const char* const CPhraseFromFileSign::Values[3] = { "O", "B", "I" };
+
+CPhraseFromFileSign::CPhraseFromFileSign( const CAuxFiles& auxFiles,
+		const string& name ) :
+	CBaseSign( Values )
+{
+	unordered_set<string> lines;
+	auxFiles.ReadWords( name, lines );
+	for( auto i = lines.cbegin(); i != lines.cend(); ++i ) {
+		phrases.AddPhrase( *i );
+	}
+	phrases.Build();
+}
+
+TSignValue CPhraseFromFileSign::Value( const CToken& /* token */ ) const
+{
+	return V_Outside;
+}
+
+void CPhraseFromFileSign::EvaluateColumn( const CTokens& tokens,
+	const CSignRows& rows, TSignValue* column ) const
+{
+	vector<uint32_t> lengths;
+	phrases.Match( tokens, rows, lengths );
+	uint32_t inside = 0;
+	for( size_t i = 0; i < rows.Size(); i++ ) {
+		if( inside > 0 ) {
+			column[i] = V_Inside;
+			inside--;
+		} else if( lengths[i] > 0 ) {
+			column[i] = V_Begin;
+			inside = lengths[i] - 1;
+		} else {
+			column[i] = V_Outside;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+
+void InitializeSigns( CSigns& signs, const string& auxFilesPath )
+{
+	signs.Clear();
+	shared_ptr<const CAuxFiles> auxFiles( new CAuxFiles( auxFilesPath ) );
+	// lists of all CLexFromFileSign signs
+	shared_ptr<CGazetteers> gazetteers( new CGazetteers( auxFiles ) );
+
+	//  (  )
+	signs.AddSign( new CTextSign() );
+
+	//  (   mystem)
+	signs.AddSign( new CLexSign() );
+
+	//  (BigBig/BigSmall/SmallSmall/Fence)
+	signs.AddSign( new CRegisterSign() );
+
+	//    
+	signs.AddSign( new CHasVowelLetterSign() );
+
+	//     () (1/2-4/5-more)
+	signs.AddSign( new CTextLengthSign() );
+
+	//   (    ,     
+	signs.AddSign( new CTokenTypeSign() );
+
+	//       ()
+	signs.AddSign( new CHasSuffixFromFileSign( *auxFiles, "surname_endings.txt" ) );
+
+	//     ()
+	signs.AddSign( new CLexFromFileSign( gazetteers, "first_names.txt" ) );
+
+	//     ()
+	signs.AddSign( new CLexFromFileSign( gazetteers, "before_organizations.txt" ) );
+
+	//     ()
+	signs.AddSign( new CLexFromFileSign( gazetteers, "before_location_words.txt" ) );
+
+	//   ()
+	signs.AddSign( new CLexFromFileSign( gazetteers, "capitals.txt" ) );
+
+	//   ()
+	signs.AddSign( new CLexFromFileSign( gazetteers, "states.txt" ) );
+
+	//   ()
+	signs.AddSign( new CLexFromFileSign( gazetteers, "surnames.txt" ) );
+
+	//     ? () (   )
+	signs.AddSign( new CIsEndOfSentenceSign );
+
+	//   ()
+	signs.AddSign( new CLexFromFileSign( gazetteers, "monetary_units.txt" ) );
+
+	//    () ->      (0/1/2-more)
+	signs.AddSign( new CHasRootFromFileSign( *auxFiles, "company_parts_for_count.txt" ) );
+
+	// C  ()
+	signs.AddSign( new CLexFromFileSign( gazetteers, "patronymics.txt" ) );
+
+	//     ,    ()
+	signs.AddSign( new CSuffixFromFileSign( *auxFiles, "surname_endings.txt" ) );
+
+	//    ,     ()
+	signs.AddSign( new CPrefixFromFileSign( *auxFiles, "first_name_prefixes.txt" ) );
+
+	//       () -> (O/B/I)
+	signs.AddSign( new CPhraseFromFileSign( *auxFiles, "phrases.txt" ) );
+
+	//   
+	signs.AddSign( new CNamedEntityTypeSign() );
+
+	gazetteers->Build();
+}
+
+//-----------------------------------------------------------------------------
+// CStaticSigns
+
+// Signs of concrete types known at compile time, so the calls of
+// the signs are not virtual and each column is one inlined loop over tokens.
+template<typename... TSigns>
+class CStaticSigns : public CBaseSigns {
+public:
+	// takes the signs of the same types from the runtime signs
+	explicit CStaticSigns( const CSigns& runtimeSigns );
+
+	virtual size_t Size() const { return sizeof...( TSigns ); }
+	virtual void AppendText( const CSignValues& values, size_t row,
+		const CStringPool& strings, string& text ) const;
+
+protected:
+	virtual void evaluateColumns( const CTokens& tokens,
+		CSignValues& values, TSignsFilter filter ) const;
+
+private:
+	typedef tuple<TSigns...> TSignTypes;
+	template<size_t Index>
+	struct CSignType {
+		typedef typename tuple_element<Index, TSignTypes>::type Type;
+	};
+	static const size_t NumberOfSigns = sizeof...( TSigns );
+
+	tuple<shared_ptr<TSigns>...> signs;
+
+	template<size_t Index>
+	typename enable_if<( Index < NumberOfSigns )>::type
+		take( const CSigns& runtimeSigns );
+	template<size_t Index>
+	typename enable_if<( Index == NumberOfSigns )>::type
+		take( const CSigns& ) {}
+
+	template<size_t Index>
+	typename enable_if<( Index < NumberOfSigns )>::type
+		evaluateColumn( const CTokens& tokens, CSignValues& values,
+			TSignsFilter filter ) const;
+	template<size_t Index>
+	typename enable_if<( Index == NumberOfSigns )>::type
+		evaluateColumn( const CTokens&, CSignValues&, TSignsFilter ) const {}
+
+	template<size_t Index>
+	typename enable_if<( Index < NumberOfSigns )>::type
+		appendText( const CSignValues& values, size_t row,
+			const CStringPool& strings, string& text ) const;
+	template<size_t Index>
+	typename enable_if<( Index == NumberOfSigns )>::type
+		appendText( const CSignValues&, size_t, const CStringPool&,
+			string& ) const {}
+};
+
+template<typename... TSigns>
+CStaticSigns<TSigns...>::CStaticSigns( const CSigns& runtimeSigns )
+{
+	if( runtimeSigns.Size() != NumberOfSigns ) {
+		throw new CException( "Signs don't match the static signs" );
+	}
+	take<0>( runtimeSigns );
+	dependsOnLex.assign( NumberOfSigns, false );
+	numberOfValues.assign( NumberOfSigns, 0 );
+	for( size_t i = 0; i < NumberOfSigns; i++ ) {
+		dependsOnLex[i] = runtimeSigns.Sign( i )->DependsOnLex();
+		numberOfValues[i] = runtimeSigns.Sign( i )->NumberOfValues();
+	}
+}
+
+template<typename... TSigns>
+void CStaticSigns<TSigns...>::AppendText( const CSignValues& values,
+	size_t row, const CStringPool& strings, string& text ) const
+{
+	appendText<0>( values, row, strings, text );
+	text += '\n';
+}
+
+template<typename... TSigns>
+void CStaticSigns<TSigns...>::evaluateColumns( const CTokens& tokens,
+	CSignValues& values, TSignsFilter filter ) const
+{
+	evaluateColumn<0>( tokens, values, filter );
+}
+
+template<typename... TSigns>
+template<size_t Index>
+typename enable_if<( Index < CStaticSigns<TSigns...>::NumberOfSigns )>::type
+	CStaticSigns<TSigns...>::take( const CSigns& runtimeSigns )
+{
+	typedef typename CSignType<Index>::Type TSign;
+	const shared_ptr<CBaseSign>& sign = runtimeSigns.Sign( Index );
+	if( typeid( *sign ) != typeid( TSign ) ) {
+		throw new CException( "Signs don't match the static signs" );
+	}
+	get<Index>( signs ) = static_pointer_cast<TSign>( sign );
+	take<Index + 1>( runtimeSigns );
+}
+
+template<typename... TSigns>
+template<size_t Index>
+typename enable_if<( Index < CStaticSigns<TSigns...>::NumberOfSigns )>::type
+	CStaticSigns<TSigns...>::evaluateColumn( const CTokens& tokens,
+		CSignValues& values, TSignsFilter filter ) const
+{
+	typedef typename CSignType<Index>::Type TSign;
+	if( isSelected( Index, filter ) ) {
+		// qualified call is not virtual
+		get<Index>( signs )->TSign::EvaluateColumn( tokens, values.Rows(),
+			values.Column( Index ) );
+	}
+	evaluateColumn<Index + 1>( tokens, values, filter );
+}
+
+template<typename... TSigns>
+template<size_t Index>
+typename enable_if<( Index < CStaticSigns<TSigns...>::NumberOfSigns )>::type
+	CStaticSigns<TSigns...>::appendText( const CSignValues& values,
+		size_t row, const CStringPool& strings, string& text ) const
+{
+	typedef typename CSignType<Index>::Type TSign;
+	if( IsUsed( Index ) ) {
+		appendValueText( Index, get<Index>( signs )->TSign::ValueText(
+			values.Value( row, Index ), strings ), text );
+	} else {
+		appendValueText( Index, UnusedSignValueText, text );
+	}
+	appendText<Index + 1>( values, row, strings, text );
+}
+
+// Types of the signs of InitializeSigns (model.crf-model is trained on them)
+typedef CStaticSigns<
+	CTextSign,
+	CLexSign,
+	CRegisterSign,
+	CHasVowelLetterSign,
+	CTextLengthSign,
+	CTokenTypeSign,
+	CHasSuffixFromFileSign,
+	CLexFromFileSign, // first_names
+	CLexFromFileSign, // before_organizations
+	CLexFromFileSign, // before_location_words
+	CLexFromFileSign, // capitals
+	CLexFromFileSign, // states
+	CLexFromFileSign, // surnames
+	CIsEndOfSentenceSign,
+	CLexFromFileSign, // monetary_units
+	CHasRootFromFileSign,
+	CLexFromFileSign, // patronymics
+	CSuffixFromFileSign, // surname_endings
+	CPrefixFromFileSign, // first_name_prefixes
+	CPhraseFromFileSign, // phrases
+	CNamedEntityTypeSign
+> CModelSigns;
+
+// Marks columns of %x[row,column] macros of the crf template as used
+void ParseTemplateColumns( const string& crfTemplate, vector<bool>& isUsed )
+{
+	const string macro( "%x[" );
+	for( size_t pos = crfTemplate.find( macro ); pos != string::npos;
+		pos = crfTemplate.find( macro, pos ) )
+	{
+		pos += macro.length();
+		const size_t comma = crfTemplate.find( ',', pos );
+		const size_t bracket = crfTemplate.find( ']', pos );
+		if( comma == string::npos || bracket == string::npos
+			|| bracket < comma )
+		{
+			throw new CException( "Bad macro in crf template" );
+		}
+		istringstream iss( crfTemplate.substr( comma + 1,
+			bracket - comma - 1 ) );
+		size_t column = 0;
+		iss >> column;
+		if( iss.fail() || !iss.eof() ) {
+			throw new CException( "Bad column of macro in crf template" );
+		}
+		if( column >= isUsed.size() ) {
+			ostringstream message;
+			message << "Crf template uses column " << column
+				<< ", but there are only " << isUsed.size() << " signs";
+			throw new CException( message.str() );
+		}
+		isUsed[column] = true;
+	}
+}
+
+// Signs of InitializeSigns in the static pipeline. Build with
+// NER_DYNAMIC_SIGNS to experiment with signs of InitializeSigns
+// without changing CModelSigns.
+// Only the signs used by the crf template are evaluated, all signs
+// are evaluated if there is no template (to prepare training data).
+CBaseSigns* CreateSigns( const string& auxFilesPath,
+	const char* crfTemplate = nullptr )
+{
+	unique_ptr<CSigns> signs( new CSigns );
+	InitializeSigns( *signs, auxFilesPath );
+#ifdef NER_DYNAMIC_SIGNS
+	unique_ptr<CBaseSigns> modelSigns( signs.release() );
+#else
+	unique_ptr<CBaseSigns> modelSigns( new CModelSigns( *signs ) );
+#endif
+	if( crfTemplate != nullptr ) {
+		vector<bool> isUsed( modelSigns->Size(), false );
+		// text of tokens is used by CConcatenator
+		isUsed[0] = true;
+		ParseTemplateColumns( crfTemplate, isUsed );
+		modelSigns->SetUsedSigns( isUsed );
+	}
+	modelSigns->EnableLexCache();
+	return modelSigns.release();
+}
+
+void PrintLexCacheStatistics( uint64_t hits, uint64_t misses )
+{
+	const uint64_t lookups = hits + misses;
+	cerr << "Lex signs cache: " << hits << " hits of " << lookups
+		<< " lookups (" << ( lookups > 0 ? 100 * hits / lookups : 0 )
+		<< "%)" << endl;
+}
+
+void PrintLexCacheStatistics( const CBaseSigns& signs )
+{
+	const CLexSignsCache* cache = signs.LexCache();
+	if( cache != nullptr ) {
+		PrintLexCacheStatistics( cache->NumberOfHits(), cache->NumberOfMisses() );
+	}
+}
+
+// SAX handler of mystem json output, one json object per token:
+// {"analysis":[{"lex":"...","gr":"..."},...],"text":"..."}
+// Only 'text' and 'lex' and 'gr' of the first analysis are read,
+// the token is added to tokens at the end of the object.
+// The handler is used for in situ parsing only, so all strings
+// stay in the parsed buffer.
+class CMystemJsonHandler :
+	public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, CMystemJsonHandler>
+{
+public:
+	explicit CMystemJsonHandler( CTokens& tokens );
+
+	const string& ErrorMessage() const { return errorMessage; }
+
+	bool Default();
+	bool String( const char* str, rapidjson::SizeType length, bool copy );
+	bool Key( const char* str, rapidjson::SizeType length, bool copy );
+	bool StartObject();
+	bool EndObject( rapidjson::SizeType memberCount );
+	bool StartArray();
+	bool EndArray( rapidjson::SizeType elementCount );
+
+private:
+	enum TField {
+		F_None,
+		F_Text,
+		F_Analysis,
+		F_Lex,
+		F_Gr
+	};
+
+	CTokens& tokens;
+	string errorMessage;
+	int depth;
+	TField field;
+	bool isInAnalysis;
+	bool hasText;
+	bool hasAnalysis;
+	int numberOfAnalyses;
+	CStringRef text;
+	CStringRef lex;
+	CStringRef gr;
+
+	static bool isKey( const char* str, rapidjson::SizeType length,
+		const char* key );
+	bool addToken();
+};
+
+CMystemJsonHandler::CMystemJsonHandler( CTokens& _tokens ) :
+	tokens( _tokens ),
+	depth( 0 ),
+	field( F_None ),
+	isInAnalysis( false ),
+	hasText( false ),
+	hasAnalysis( false ),
+	numberOfAnalyses( 0 )
+{
+}
+
+bool CMystemJsonHandler::Default()
+{
+	field = F_None;
+	if( depth == 0 ) {
+		errorMessage = "json object expected";
+		return false;
+	}
+	return true;
+}
+
+bool CMystemJsonHandler::String( const char* str,
+	rapidjson::SizeType length, bool copy )
+{
+	// strings are parsed in situ, so they refer to the source buffer
+	assert( !copy );
+	( void )copy; // for NDEBUG
+	switch( field ) {
+		case F_Text:
+			text = CStringRef( str, length );
+			hasText = true;
+			break;
+		case F_Lex:
+			lex = CStringRef( str, length );
+			break;
+		case F_Gr:
+			gr = CStringRef( str, length );
+			break;
+		default:
+			break;
+	}
+	return Default();
+}
+
+bool CMystemJsonHandler::Key( const char* str,
+	rapidjson::SizeType length, bool /* copy */ )
+{
+	field = F_None;
+	if( depth == 1 ) {
+		if( isKey( str, length, "text" ) ) {
+			field = F_Text;
+		} else if( isKey( str, length, "analysis" ) ) {
+			field = F_Analysis;
+		}
+	} else if( depth == 3 && isInAnalysis && numberOfAnalyses == 1 ) {
+		if( isKey( str, length, "lex" ) ) {
+			field = F_Lex;
+		} else if( isKey( str, length, "gr" ) ) {
+			field = F_Gr;
+		}
+	}
+	return true;
+}
+
+bool CMystemJsonHandler::StartObject()
+{
+	field = F_None;
+	depth++;
+	if( depth == 1 ) {
+		hasText = false;
+		hasAnalysis = false;
+		numberOfAnalyses = 0;
+		lex = CStringRef();
+		gr = CStringRef();
+	} else if( depth == 3 && isInAnalysis ) {
+		numberOfAnalyses++;
+	}
+	return true;
+}
+
+bool CMystemJsonHandler::EndObject( rapidjson::SizeType /* memberCount */ )
+{
+	field = F_None;
+	depth--;
+	if( depth == 0 ) {
+		return addToken();
+	}
+	return true;
+}
+
+bool CMystemJsonHandler::StartArray()
+{
+	if( depth == 0 ) {
+		return Default();
+	}
+	if( depth == 1 && field == F_Analysis ) {
+		isInAnalysis = true;
+		hasAnalysis = true;
+	}
+	field = F_None;
+	depth++;
+	return true;
+}
+
+bool CMystemJsonHandler::EndArray( rapidjson::SizeType /* elementCount */ )
+{
+	field = F_None;
+	depth--;
+	if( depth == 1 ) {
+		isInAnalysis = false;
+	}
+	return true;
+}
+
+bool CMystemJsonHandler::isKey( const char* str,
+	rapidjson::SizeType length, const char* key )
+{
+	return ( strlen( key ) == length && memcmp( str, key, length ) == 0 );
+}
+
+bool CMystemJsonHandler::addToken()
+{
+	if( !hasText ) {
+		errorMessage = "json object has no 'text'";
+		return false;
+	}
+	if( hasAnalysis ) {
+		if( numberOfAnalyses > 0 ) {
+			tokens.AddWord( text, lex, gr.Data() );
+		} else {
+			tokens.AddWord( TT_EngWord, text, text );
+		}
+	} else {
+		tokens.AddPunctuationMarks( text );
+	}
+	return true;
+}
+
+// sourceName is used in error messages
+void ReadTokensFromJson( const shared_ptr<CTextBuffer>& input,
+	const string& sourceName, CTokens& tokens )
+{
+	tokens.SetSource( input );
+	// strings are unescaped and terminated in the buffer,
+	// tokens refer to them
+	rapidjson::InsituStringStream stream( input->Data() );
+	rapidjson::Reader reader;
+	CMystemJsonHandler handler( tokens );
+	while( true ) {
+		rapidjson::SkipWhitespace( stream );
+		if( stream.Peek() == '\0' ) {
+			break;
+		}
+		reader.Parse<rapidjson::kParseInsituFlag
+			| rapidjson::kParseStopWhenDoneFlag>( stream, handler );
+		if( reader.HasParseError() ) {
+			ostringstream message;
+			message << "Can't read json object at offset "
+				<< reader.GetErrorOffset() << " of " << sourceName
+				<< ": " << ( handler.ErrorMessage().empty() ?
+					rapidjson::GetParseError_En( reader.GetParseErrorCode() ) :
+					handler.ErrorMessage().c_str() );
+			throw new CException( message.str() );
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+
+// Binary cache of tokens of a mystem json file, it is saved next to
+// the json file, so the next pass over the same text does not parse json.
+// Layout: header, records of interned strings, records of all tokens,
+// blob of the strings.
+// The cache is valid while size and modification time of json file
+// are the same as at the moment of its creation.
+
+struct CTokensCacheHeader {
+	char Magic[8];
+	uint32_t Version;
+	uint32_t NumberOfTokens;
+	uint32_t NumberOfStrings;
+	uint32_t Reserved;
+	uint64_t BlobSize;
+	uint64_t SourceSize;
+	int64_t SourceModificationTime;
+};
+
+struct CTokensCacheString {
+	uint32_t Offset;
+	uint32_t Length;
+};
+
+struct CTokensCacheRecord {
+	TStringId TextId;
+	TStringId LexId;
+	TGrammemes Grammemes;
+	uint8_t Type;
+	uint8_t IsEndOfSentence;
+	uint8_t Reserved[6];
+};
+
+const char TokensCacheMagic[8] = { 'N', 'E', 'R', 'T', 'O', 'K', 'S', '\0' };
+const uint32_t TokensCacheVersion = 5;
+
+bool ReadTokensCache( const string& textFileName,
+	const string& cacheFileName, CTokens& tokens )
+{
+	uint64_t sourceSize;
+	int64_t sourceModificationTime;
+	struct stat cacheStat;
+	if( !GetFileSizeAndTime( textFileName, sourceSize, sourceModificationTime )
+		|| stat( cacheFileName.c_str(), &cacheStat ) != 0
+		|| static_cast<size_t>( cacheStat.st_size ) < sizeof( CTokensCacheHeader ) )
+	{
+		return false;
+	}
+
+	shared_ptr<CMappedFile> cacheFile( new CMappedFile( cacheFileName ) );
+	const CTokensCacheHeader* header =
+		reinterpret_cast<const CTokensCacheHeader*>( cacheFile->Data() );
+	const size_t stringsSize =
+		header->NumberOfStrings * sizeof( CTokensCacheString );
+	const size_t recordsSize =
+		header->NumberOfTokens * sizeof( CTokensCacheRecord );
+	if( memcmp( header->Magic, TokensCacheMagic, sizeof( TokensCacheMagic ) ) != 0
+		|| header->Version != TokensCacheVersion
+		|| header->SourceSize != sourceSize
+		|| header->SourceModificationTime != sourceModificationTime
+		|| cacheFile->Size() != sizeof( CTokensCacheHeader )
+			+ stringsSize + recordsSize + header->BlobSize )
+	{
+		return false;
+	}
+
+	const CTokensCacheString* strings =
+		reinterpret_cast<const CTokensCacheString*>( header + 1 );
+	const CTokensCacheRecord* records =
+		reinterpret_cast<const CTokensCacheRecord*>(
+			strings + header->NumberOfStrings );
+	const char* blob = reinterpret_cast<const char*>(
+		records + header->NumberOfTokens );
+	tokens.SetSource( cacheFile );
+	// the strings are unique, so they get the same ids once again
+	for( uint32_t i = 0; i < header->NumberOfStrings; i++ ) {
+		if( static_cast<uint64_t>( strings[i].Offset ) + strings[i].Length
+				> header->BlobSize
+			|| tokens.Intern( CStringRef( blob + strings[i].Offset,
+				strings[i].Length ) ) != i )
+		{
+			tokens.SetSource( shared_ptr<CTextBuffer>() );
+			return false;
+		}
+	}
+	tokens.Reserve( header->NumberOfTokens );
+	for( uint32_t i = 0; i < header->NumberOfTokens; i++ ) {
+		const CTokensCacheRecord& record = records[i];
+		if( record.Type == TT_None || record.Type > TT_Dash
+			|| record.TextId >= header->NumberOfStrings
+			|| record.LexId >= header->NumberOfStrings )
+		{
+			tokens.SetSource( shared_ptr<CTextBuffer>() );
+			return false;
+		}
+		tokens.AddInterned( static_cast<TTokenType>( record.Type ),
+			record.LexId, record.TextId, record.Grammemes );
+		if( record.IsEndOfSentence != 0 ) {
+			tokens.SetEndOfSentence( i );
+		}
+	}
+	return true;
+}
+
+// the cache is an optimization only, so errors of writing are ignored
+void WriteTokensCache( const string& textFileName,
+	const string& cacheFileName, const CTokens& tokens )
+{
+	CTokensCacheHeader header;
+	memcpy( header.Magic, TokensCacheMagic, sizeof( TokensCacheMagic ) );
+	header.Version = TokensCacheVersion;
+	header.NumberOfTokens = static_cast<uint32_t>( tokens.Size() );
+	header.NumberOfStrings = static_cast<uint32_t>( tokens.Strings().Size() );
+	header.Reserved = 0;
+	if( !GetFileSizeAndTime( textFileName,
+		header.SourceSize, header.SourceModificationTime ) )
+	{
+		return;
+	}
+
+	vector<CTokensCacheString> strings( header.NumberOfStrings );
+	string blob;
+	for( uint32_t i = 0; i < header.NumberOfStrings; i++ ) {
+		const CStringRef& str = tokens.Strings().String( i );
+		strings[i].Offset = static_cast<uint32_t>( blob.length() );
+		strings[i].Length = static_cast<uint32_t>( str.Length() );
+		blob.append( str.Data(), str.Length() );
+	}
+	header.BlobSize = blob.length();
+
+	vector<CTokensCacheRecord> records;
+	records.reserve( tokens.Size() );
+	for( size_t i = 0; i < tokens.Size(); i++ ) {
+		CTokensCacheRecord record;
+		memset( &record, 0, sizeof( record ) );
+		record.TextId = tokens.TextId( i );
+		record.LexId = tokens.LexId( i );
+		record.Grammemes = tokens.Grammemes( i );
+		record.Type = static_cast<uint8_t>( tokens.Type( i ) );
+		record.IsEndOfSentence = tokens.IsEndOfSentence( i ) ? 1 : 0;
+		records.push_back( record );
+	}
+
+	vector<CStringRef> parts;
+	parts.push_back( CStringRef( reinterpret_cast<const char*>( &header ),
+		sizeof( header ) ) );
+	parts.push_back( CStringRef( reinterpret_cast<const char*>( strings.data() ),
+		strings.size() * sizeof( CTokensCacheString ) ) );
+	parts.push_back( CStringRef( reinterpret_cast<const char*>( records.data() ),
+		records.size() * sizeof( CTokensCacheRecord ) ) );
+	parts.push_back( CStringRef( blob.data(), blob.length() ) );
+	// the cache is an optimization only, so an error is ignored
+	WriteFileByRename( cacheFileName, parts );
+}
+
+//------------------------------------------------------------------------------
+
+// if useTokensCache is true the tokens are read from the cache
+// next to the json file or the cache is created
+void ReadTokens( const string& textFileName, CTokens& tokens,
+	bool useTokensCache = false )
+{
+	const string cacheFileName = textFileName + TokensCacheExtension;
+	if( !useTokensCache
+		|| !ReadTokensCache( textFileName, cacheFileName, tokens ) )
+	{
+		ReadTokensFromJson(
+			shared_ptr<CTextBuffer>( new CMappedFile( textFileName ) ),
+			"file '" + textFileName + "'", tokens );
+		if( useTokensCache && !tokens.IsEmpty() ) {
+			WriteTokensCache( textFileName, cacheFileName, tokens );
+		}
+	}
+	if( tokens.IsEmpty() ) {
+		throw new CException( "There are no tokens in file '"
+			+ textFileName + "'" );
+	}
+}
+
+void ReadAnswer( const string& answerFileName, CTokens& tokens )
+{
+	map<size_t, pair<size_t, TNamedEntityType> > answers;
+	// parse answer file
+	ifstream inputFile( answerFileName );
+	if( !inputFile.good() ) {
+		throw new CException( "Can't open answer file '"
+			+ answerFileName + "'" );
+	}
+	while( inputFile.good() ) {
+		string line;
+		getline( inputFile, line );
+		if( line.empty() ) {
+			continue;
+		}
+		istringstream iss( line );
+		string type;
+		size_t start;
+		size_t end;
+		iss >> type >> start >> end;
+		TNamedEntityType namedEntityType = NET_None;
+		if( type == "LOC" ) {
+			namedEntityType = NET_Loc;
+		} else if( type == "ORG" ) {
+			namedEntityType = NET_Org;
+		} else if( type == "PER" ) {
+			namedEntityType = NET_Person;
+		}
+		if( iss.fail() || namedEntityType == NET_None || end <= start ) {
+			throw new CException( "Bad answer file '"
+				+ answerFileName + "' format" );
+		}
+		answers.insert( make_pair( start, make_pair( end, namedEntityType ) ) );
+	}
+	// set named entiry type for tokens
+	size_t ti = 0;
+	for( auto i = answers.cbegin(); i != answers.cend(); ++i ) {
+		ti = tokens.FindByOffset( i->first, ti );
+		do {
+			if( ti == tokens.Size() ) {
+				throw new CException( "Answer of file '" + answerFileName
+					+ "' is out of the text" );
+			}
+			if( !IsMark( tokens.Type( ti ) ) ) {
+				tokens.SetNamedEntityType( ti, i->second.second );
+			}
+			ti++;
+		} while( tokens.EndOffset( ti - 1 ) < i->second.first );
+	}
+}
+
+string GetPath( const string& filename )
+{
+	string::size_type i = filename.find_last_of( "\\/" );
+	if( i != string::npos ) {
+		return filename.substr( 0, i + 1 );
+	}
+	return "./";
+}
+
+//------------------------------------------------------------------------------
+
+// Concatenation rules:
+// -         ( ,    )   .
+// -   : ORG LOC,    ORG.
+// -   : ORG (.) PER,    ORG.
+class CConcatenator {
+public:
+	static void Concatenate( const string& crfTestedFilename,
+		const CTokens& tokens, COutputBuffer& output );
+	static void Concatenate( const CRFPP::Tagger& tagger,
+		const CTokens& tokens, COutputBuffer& output );
+
+private:
+	CConcatenator( const CTokens& tokens, COutputBuffer& ouput );
+
+	void readCrfTestedFile( const string& crfTestedFilename );
+	void readTagger( const CRFPP::Tagger& tagger );
+	void startNe( TNamedEntityType type );
+	void endNe( TNamedEntityType type, bool ignoreLastWord = false );
+	bool parseLine( const string& line, string& text,
+		TNamedEntityType& type ) const;
+	static bool parseType( const string& typeText, TNamedEntityType& type );
+	void addToken( const string& token, TNamedEntityType type );
+	bool isSimpleDot() const;
+
+	typedef void ( CConcatenator::*TState )( TNamedEntityType type );
+
+	void stateNone( TNamedEntityType type );
+	void stateOrg( TNamedEntityType type );
+	void stateOrgIm( TNamedEntityType type );
+	void stateOrgImeny( TNamedEntityType type );
+	void stateOrgImenyPerson( TNamedEntityType type );
+	void stateLoc( TNamedEntityType type );
+	void statePerson( TNamedEntityType type );
+
+	COutputBuffer& output; // lines of named entities are appended
+	const CTokens& tokens;
+	size_t token; // index of the current token
+	size_t neToken; // index of the first token of the named entity
+
+	TState state;
+};
+
+void CConcatenator::Concatenate( const string& crfTestedFilename,
+		const CTokens& tokens, COutputBuffer& output )
+{
+	CConcatenator concatenate( tokens, output );
+	concatenate.readCrfTestedFile( crfTestedFilename );
+}
+
+void CConcatenator::Concatenate( const CRFPP::Tagger& tagger,
+		const CTokens& tokens, COutputBuffer& output )
+{
+	CConcatenator concatenate( tokens, output );
+	concatenate.readTagger( tagger );
+}
+
+CConcatenator::CConcatenator( const CTokens& _tokens, COutputBuffer& _output ):
+	output( _output ),
+	tokens( _tokens ),
+	token( 0 ),
+	neToken( tokens.Size() ),
+	state( &CConcatenator::stateNone )
+{
+}
+
+void CConcatenator::readCrfTestedFile( const string& crfTestedFilename )
+{
+	ifstream input( crfTestedFilename );
+	if( !input.good() ) {
+		throw new CException( "Crf tested file '"
+			+ crfTestedFilename + "' not found" );
+	}
+
+	string line;
+	string text;
+	TNamedEntityType type;
+	while( input.good() ) {
+		getline( input, line );
+		if( !line.empty() && line.back() == '\r' ) {
+			line.pop_back();
+		}
+		if( line.empty() ) {
+			continue;
+		}
+		if( !parseLine( line, text, type ) ) {
+			input.clear();
+			input.setstate( ios::failbit );
+			break;
+		}
+		addToken( text, type );
+	}
+	if( !input.eof() && input.fail() ) {
+		throw new CException( "Bad crf tested file '"
+			+ crfTestedFilename + "' format" );
+	}
+}
+
+void CConcatenator::readTagger( const CRFPP::Tagger& tagger )
+{
+	TNamedEntityType type;
+	for( size_t i = 0; i < tagger.size(); i++ ) {
+		if( !parseType( tagger.y2( i ), type ) ) {
+			throw new CException( string( "Unknown named entity type '" )
+				+ tagger.y2( i ) + "' in crf model" );
+		}
+		addToken( tagger.x( i, 0 ), type );
+	}
+}
+
+void CConcatenator::startNe( TNamedEntityType type )
+{
+	if( type == NET_None ) {
+		state = &CConcatenator::stateNone;
+		return;
+	}
+
+	neToken = token;
+
+	if( type == NET_Org ) {
+		state = &CConcatenator::stateOrg;
+	} else if( type == NET_Loc ) {
+		state = &CConcatenator::stateLoc;
+	} else if( type == NET_Person ) {
+		state = &CConcatenator::statePerson;
+	} else {
+		assert( false );
+	}
+}
+
+void CConcatenator::endNe( TNamedEntityType type, bool ignoreLastWord )
+{
+	assert( neToken != tokens.Size() );
+	if( type == NET_Org ) {
+		output.Append( "ORG" );
+	} else if( type == NET_Loc ) {
+		output.Append( "LOC" );
+	} else if( type == NET_Person ) {
+		output.Append( "PER" );
+	} else {
+		assert( false );
+	}
+
+	size_t end = token;
+	do {
+		end--;
+	} while( !IsWord( tokens.Type( end ) ) );
+	if( ignoreLastWord ) {
+		do {
+			end--;
+		} while( !IsWord( tokens.Type( end ) ) );
+	}
+	end++;
+
+	const size_t neOffset = tokens.BeginOffset( neToken );
+	output.Append( ' ' );
+	output.AppendNumber( neOffset );
+	output.Append( ' ' );
+	output.AppendNumber( tokens.EndOffset( end - 1 ) - neOffset );
+	output.Append( '\n' );
+	neToken = tokens.Size();
+}
+
+bool CConcatenator::parseLine( const string& line, string& text,
+	TNamedEntityType& type ) const
+{
+	text.clear();
+	type = NET_None;
+
+	string::size_type textEndPos = line.find( '\t' );
+	string::size_type neBeginPos = line.rfind( '\t' );
+
+	if( textEndPos == string::npos || neBeginPos == string::npos ) {
+		return false;
+	}
+
+	text = line.substr( 0, textEndPos );
+	if( text.empty() ) {
+		return false;
+	}
+
+	return parseType( line.substr( neBeginPos + 1 ), type );
+}
+
+bool CConcatenator::parseType( const string& typeText,
+	TNamedEntityType& type )
+{
+	type = NET_None;
+
+	if( typeText == "Org" ) {
+		type = NET_Org;
+	} else if( typeText == "Loc" ) {
+		type = NET_Loc;
+	} else if( typeText == "Person" ) {
+		type = NET_Person;
+	} else if( typeText != "NO" ) {
+		return false;
+	}
+
+	return true;
+}
+
+void CConcatenator::addToken( const string& text, TNamedEntityType type )
+{
+	while( token != tokens.Size() && !IsWordOrMark( tokens.Type( token ) ) ) {
+		token++;
+	}
+
+	if( token == tokens.Size() || tokens.Text( token ) != text ) {
+		throw new CException( "Json or tested file(s) is(are) corrupted" );
+	}
+
+	( this->*state )( type );
+	token++;
+}
+
+bool CConcatenator::isSimpleDot() const
+{
+	return ( tokens.Type( token ) == TT_Dot
+		&& !tokens.IsEndOfSentence( token ) );
+}
+
+void CConcatenator::stateNone( TNamedEntityType type )
+{
+	startNe( type );
+}
+
+void CConcatenator::stateOrg( TNamedEntityType type )
+{
+	if( type == NET_None ) {
+		if( tokens.Text( token ) == "" ) { // TODO: compare case insensitive
+			state = &CConcatenator::stateOrgIm;
+		} else if( tokens.Text( token ) == "" ) { // TODO: compare case insensitive
+			state = &CConcatenator::stateOrgImeny;
+		} else if( !isSimpleDot() ) {
+			endNe( NET_Org );
+			startNe( type );
+		}
+	} else if( type != NET_Org && !isSimpleDot() ) {
+		endNe( NET_Org );
+		startNe( type );
+	}
+}
+
+void CConcatenator::stateOrgIm( TNamedEntityType type )
+{
+	if( tokens.Type( token ) == TT_Dot ) {
+		state = &CConcatenator::stateOrgImeny;
+	} else {
+		endNe( NET_Org, true );
+		startNe( type );
+	}
+}
+
+void CConcatenator::stateOrgImeny( TNamedEntityType type )
+{
+	if( type != NET_Person ) {
+		endNe( NET_Org, true );
+		startNe( type );
+	} else {
+		state = &CConcatenator::stateOrgImenyPerson;
+	}
+}
+
+void CConcatenator::stateOrgImenyPerson( TNamedEntityType type )
+{
+	if( type != NET_Person && !isSimpleDot() ) {
+		endNe( NET_Org );
+		startNe( type );
+	}
+}
 
-	//    
-	signs.AddSign( new CHasVowelLetterSign() );
+void CConcatenator::stateLoc( TNamedEntityType type )
+{
+	if( type != NET_Loc && !isSimpleDot() ) {
+		endNe( NET_Loc );
+		startNe( type );
+	}
+}
 
-	//     () (1/2-4/5-more)
-	signs.AddSign( new CTextLengthSign() );
+void CConcatenator::statePerson( TNamedEntityType type )
+{
+	if( type != NET_Person && !isSimpleDot() ) {
+		endNe( NET_Person );
+		startNe( type );
+	}
+}
 
-	//   (    ,     
-	signs.AddSign( new CTokenTypeSign() );
+//------------------------------------------------------------------------------
 
-	//       ()
-	signs.AddSign( new CHasSuffixFromFileSign( auxFilesPath + "surname_endings.txt" ) );
+// appends lines of signs of tokens [begin, end) to output
+void PrepareSigns( const CBaseSigns& signs, const CTokens& tokens,
+	size_t begin, size_t end, string& output )
+{
+	CSignValues values;
+	signs.Evaluate( tokens, begin, end, values );
+	for( size_t row = 0; row < values.NumberOfRows(); row++ ) {
+		signs.AppendText( values, row, tokens.Strings(), output );
+	}
+}
 
-	//     ()
-	signs.AddSign( new CLexFromFileSign( auxFilesPath + "first_names.txt" ) );
+// number of tokens of a chunk, signs are evaluated chunk by chunk
+const size_t SignsChunkSize = 4096;
 
-	//     ()
-	signs.AddSign( new CLexFromFileSign( auxFilesPath + "before_organizations.txt" ) );
+// splits tokens into chunks [begin, end) ending at ends of sentences,
+// signs depending on neighbours (CPhraseFromFileSign) don't look over
+// ends of sentences, so a chunk has the same signs as the whole text
+void SplitIntoChunks( const CTokens& tokens,
+	vector<pair<size_t, size_t> >& chunks )
+{
+	chunks.clear();
+	size_t begin = 0;
+	for( size_t i = 0; i < tokens.Size(); i++ ) {
+		if( ( tokens.IsEndOfSentence( i ) && i + 1 - begin >= SignsChunkSize )
+			|| i + 1 == tokens.Size() )
+		{
+			chunks.push_back( make_pair( begin, i + 1 ) );
+			begin = i + 1;
+		}
+	}
+}
 
-	//     ()
-	signs.AddSign( new CLexFromFileSign( auxFilesPath + "before_location_words.txt" ) );
+void PrepareSigns( const string& auxFilesPath, const CTokens& tokens )
+{
+	// intialize token signs
+	unique_ptr<CBaseSigns> signs( CreateSigns( auxFilesPath ) );
+	vector<pair<size_t, size_t> > chunks;
+	SplitIntoChunks( tokens, chunks );
+	CFileOutput output;
+	CSignValues values;
+	string line;
+	for( auto chunk = chunks.cbegin(); chunk != chunks.cend(); ++chunk ) {
+		signs->Evaluate( tokens, chunk->first, chunk->second, values );
+		for( size_t row = 0; row < values.NumberOfRows(); row++ ) {
+			line.clear();
+			signs->AppendText( values, row, tokens.Strings(), line );
+			output.Append( line );
+		}
+	}
+	output.Flush();
+}
 
-	//   ()
-	signs.AddSign( new CLexFromFileSign( auxFilesPath + "capitals.txt" ) );
+//------------------------------------------------------------------------------
 
-	//   ()
-	signs.AddSign( new CLexFromFileSign( auxFilesPath + "states.txt" ) );
+// Does the whole crf_test + --prepare-answer-file job in memory:
+// signs of tokens are passed straight to CRF++ tagger and its labels
+// are passed straight to the concatenator.
+// The recognizer is shared by threads, each thread uses its own tagger.
+// Signs are an immutable snapshot which is replaced by ReloadSigns
+// atomically, a document is recognized by the snapshot taken at its start
+// and the previous snapshot is freed by the last document which uses it.
+// Counters of the lex cache of a freed snapshot are added to the retired
+// ones, so the statistics cover all snapshots of the recognizer.
+class CRecognizer {
+public:
+	CRecognizer( const string& auxFilesPath, const string& modelFilename );
+
+	shared_ptr<const CBaseSigns> Signs() const { return atomic_load( &signs ); }
+	// reads auxiliary files again, the current signs are used
+	// by other threads until the new ones are ready
+	void ReloadSigns();
+	// taggers share the model of the recognizer
+	CRFPP::Tagger* CreateTagger() const;
+	// prints the statistics of the lex cache of all snapshots
+	void PrintLexCacheStatistics() const;
+
+	// task1 lines are appended to output
+	void Recognize( CRFPP::Tagger& tagger, const CTokens& tokens,
+		COutputBuffer& output ) const;
+	// signsLines are signs of tokens prepared by PrepareSigns
+	void Recognize( CRFPP::Tagger& tagger, const CTokens& tokens,
+		const string& signsLines, COutputBuffer& output ) const;
 
-	//   ()
-	signs.AddSign( new CLexFromFileSign( auxFilesPath + "surnames.txt" ) );
+private:
+	const string auxFilesPath;
+	unique_ptr<CRFPP::Model> model;
+	// lex cache counters of the freed snapshots, are declared
+	// before signs, so the last snapshot is freed before them
+	atomic<uint64_t> retiredHits;
+	atomic<uint64_t> retiredMisses;
+	// only the signs used by the template of the model,
+	// is accessed only by atomic_load and atomic_store
+	shared_ptr<const CBaseSigns> signs;
+
+	shared_ptr<const CBaseSigns> createSigns();
+	void retireSigns( const CBaseSigns* oldSigns );
+	static CRFPP::Model* createModel( const string& modelFilename );
+	static void addToTagger( CRFPP::Tagger& tagger, const string& line );
+	static void parseByTagger( CRFPP::Tagger& tagger );
+};
 
-	//     ? () (   )
-	signs.AddSign( new CIsEndOfSentenceSign );
+CRecognizer::CRecognizer( const string& _auxFilesPath,
+		const string& modelFilename ) :
+	auxFilesPath( _auxFilesPath ),
+	model( createModel( modelFilename ) ),
+	retiredHits( 0 ),
+	retiredMisses( 0 ),
+	signs( createSigns() )
+{
+}
 
-	//   ()
-	signs.AddSign( new CLexFromFileSign( auxFilesPath + "monetary_units.txt" ) );
+void CRecognizer::ReloadSigns()
+{
+	shared_ptr<const CBaseSigns> newSigns = createSigns();
+	atomic_store( &signs, newSigns );
+}
 
-	//    () ->      (0/1/2-more)
-	signs.AddSign( new CHasRootFromFileSign( auxFilesPath + "company_parts_for_count.txt" ) );
+void CRecognizer::PrintLexCacheStatistics() const
+{
+	const shared_ptr<const CBaseSigns> currentSigns = Signs();
+	const CLexSignsCache* cache = currentSigns->LexCache();
+	if( cache != nullptr ) {
+		::PrintLexCacheStatistics( retiredHits + cache->NumberOfHits(),
+			retiredMisses + cache->NumberOfMisses() );
+	}
+}
 
-	//    ()
-	// signs.AddSign( new CHasPrefixFromFileSign( auxFilesPath + "first_name_prefixes.txt" ) );
+shared_ptr<const CBaseSigns> CRecognizer::createSigns()
+{
+	return shared_ptr<const CBaseSigns>(
+		CreateSigns( auxFilesPath, model->getTemplate() ),
+		[this]( const CBaseSigns* oldSigns ) { retireSigns( oldSigns ); } );
+}
 
-	// C  ()
-	signs.AddSign( new CLexFromFileSign( auxFilesPath + "patronymics.txt" ) );
+void CRecognizer::retireSigns( const CBaseSigns* oldSigns )
+{
+	const CLexSignsCache* cache = oldSigns->LexCache();
+	if( cache != nullptr ) {
+		retiredHits += cache->NumberOfHits();
+		retiredMisses += cache->NumberOfMisses();
+	}
+	delete oldSigns;
+}
 
-	//   
-	signs.AddSign( new CNamedEntityTypeSign() );
+CRFPP::Model* CRecognizer::createModel( const string& modelFilename )
+{
+	vector<char> modelArgument( modelFilename.cbegin(), modelFilename.cend() );
+	modelArgument.push_back( '\0' );
+	char programArgument[] = "NamedEntityRecognition";
+	char modelOption[] = "-m";
+	char* modelArguments[] = {
+		programArgument, modelOption, modelArgument.data() };
+	CRFPP::Model* model = CRFPP::createModel( 3, modelArguments );
+	if( model == nullptr ) {
+		throw new CException( "Can't load crf model '" + modelFilename
+			+ "': " + CRFPP::getLastError() );
+	}
+	return model;
 }
 
-void ReadTokens( const string& textFileName, CTokens& tokens )
+CRFPP::Tagger* CRecognizer::CreateTagger() const
 {
-	tokens.clear();
-	ifstream inputFile( textFileName );
-	while( inputFile.good() ) {
-		string line;
-		getline( inputFile, line );
-		if( line.empty() ) {
-			continue;
+	CRFPP::Tagger* tagger = model->createTagger();
+	if( tagger == nullptr ) {
+		throw new CException( string( "Can't create crf tagger: " )
+			+ CRFPP::getLastError() );
+	}
+	return tagger;
+}
+
+void CRecognizer::Recognize( CRFPP::Tagger& tagger, const CTokens& tokens,
+	COutputBuffer& output ) const
+{
+	// the signs are not changed by ReloadSigns during the document
+	const shared_ptr<const CBaseSigns> currentSigns = Signs();
+	vector<pair<size_t, size_t> > chunks;
+	SplitIntoChunks( tokens, chunks );
+	tagger.clear();
+	CSignValues values;
+	string line;
+	for( auto chunk = chunks.cbegin(); chunk != chunks.cend(); ++chunk ) {
+		currentSigns->Evaluate( tokens, chunk->first, chunk->second, values );
+		for( size_t row = 0; row < values.NumberOfRows(); row++ ) {
+			line.clear();
+			currentSigns->AppendText( values, row, tokens.Strings(), line );
+			line.erase( line.length() - 1 ); // '\n'
+			addToTagger( tagger, line );
 		}
-		rapidjson::Document document;
-		document.Parse( line.c_str(), line.length() );
-		if( !document.IsObject() ) {
-			throw new CException( "Can't read json object from line '"
-				+ line + "' of file '" + textFileName + "'" );
-		}
-		rapidjson::Value token = document.GetObject();
-		const char* text = token["text"].GetString();
-		if( token.HasMember( "analysis" ) ) {
-			rapidjson::Value lexArray = token["analysis"].GetArray();
-			if( lexArray.Size() > 0 ) {
-				rapidjson::Value firstLex = lexArray[0].GetObject();
-				tokens.AddWord( text, firstLex["lex"].GetString(),
-					firstLex["gr"].GetString() );
-			} else {
-				tokens.push_back( CToken( TT_EngWord, text, text ) );
-			}
-		} else {
-			tokens.AddPunctuationMarks( text );
+	}
+	parseByTagger( tagger );
+	CConcatenator::Concatenate( tagger, tokens, output );
+}
+
+void CRecognizer::Recognize( CRFPP::Tagger& tagger, const CTokens& tokens,
+	const string& signsLines, COutputBuffer& output ) const
+{
+	tagger.clear();
+	string line;
+	for( size_t begin = 0; begin < signsLines.length(); ) {
+		size_t end = signsLines.find( '\n', begin );
+		if( end == string::npos ) {
+			end = signsLines.length();
 		}
+		line.assign( signsLines, begin, end - begin );
+		addToTagger( tagger, line );
+		begin = end + 1;
 	}
-	if( tokens.empty() ) {
-		throw new CException( "There are no tokens in file '"
-			+ textFileName + "'" );
+	parseByTagger( tagger );
+	CConcatenator::Concatenate( tagger, tokens, output );
+}
+
+void CRecognizer::addToTagger( CRFPP::Tagger& tagger, const string& line )
+{
+	if( !tagger.add( line.c_str() ) ) {
+		throw new CException( string( "Crf tagger error: " )
+			+ tagger.what() );
 	}
 }
 
-void AddTokenToOffset( const CToken& token, size_t& offset )
+void CRecognizer::parseByTagger( CRFPP::Tagger& tagger )
 {
-	assert( token.Type != TT_None );
-	if( !IsMark( token.Type ) ) {
-		//cout << offset << " " << token.Text << endl;
-		offset += token.Text.length();
+	if( !tagger.parse() ) {
+		throw new CException( string( "Crf tagger error: " )
+			+ tagger.what() );
 	}
 }
 
-void ReadAnswer( const string& answerFileName, CTokens& tokens )
+//------------------------------------------------------------------------------
+
+void PrepareTestFile( const char* argv[] )
 {
-	map<size_t, pair<size_t, TNamedEntityType> > answers;
-	// parse answer file
-	ifstream inputFile( answerFileName );
-	while( inputFile.good() ) {
-		string line;
-		getline( inputFile, line );
-		if( line.empty() ) {
-			continue;
-		}
-		istringstream iss( line );
-		string type;
-		size_t start;
-		size_t end;
-		iss >> type >> start >> end;
-		TNamedEntityType namedEntityType = NET_None;
-		if( type == "LOC" ) {
-			namedEntityType = NET_Loc;
-		} else if( type == "ORG" ) {
-			namedEntityType = NET_Org;
-		} else if( type == "PER" ) {
-			namedEntityType = NET_Person;
-		}
-		if( iss.fail() || namedEntityType == NET_None || end <= start ) {
-			throw new CException( "Bad answer file '"
-				+ answerFileName + "' format" );
-		}
-		answers.insert( make_pair( start, make_pair( end, namedEntityType ) ) );
+	CTokens tokens;
+	ReadTokens( argv[2], tokens, true );
+	PrepareSigns( GetPath( argv[0] ) + AuxFileRelativePath, tokens );
+}
+
+//------------------------------------------------------------------------------
+
+void PrepareTrainFile( const char* argv[] )
+{
+	CTokens tokens;
+	ReadTokens( argv[2], tokens );
+	ReadAnswer( argv[3], tokens );
+	PrepareSigns( GetPath( argv[0] ) + AuxFileRelativePath, tokens );
+}
+
+//------------------------------------------------------------------------------
+
+void PrepareAnswerFile( const char* argv[] )
+{
+	CTokens tokens;
+	ReadTokens( argv[2], tokens, true );
+	CFileOutput output;
+	CConcatenator::Concatenate( argv[3], tokens, output );
+	output.Flush();
+}
+
+//------------------------------------------------------------------------------
+
+void Recognize( const char* argv[] )
+{
+	const string path = GetPath( argv[0] );
+	CRecognizer recognizer( path + AuxFileRelativePath,
+		path + ModelRelativePath );
+	unique_ptr<CRFPP::Tagger> tagger( recognizer.CreateTagger() );
+	CTokens tokens;
+	ReadTokens( argv[2], tokens );
+	CFileOutput output;
+	recognizer.Recognize( *tagger, tokens, output );
+	output.Flush();
+}
+
+//------------------------------------------------------------------------------
+// Batch modes: all documents are processed by one process,
+// so signs (and crf model) are loaded only once.
+
+bool IsDirectory( const string& path )
+{
+	struct stat pathStat;
+	return ( stat( path.c_str(), &pathStat ) == 0
+		&& ( pathStat.st_mode & S_IFMT ) == S_IFDIR );
+}
+
+bool HasExtension( const string& fileName, const char* extension )
+{
+	const size_t length = strlen( extension );
+	return ( fileName.length() > length
+		&& fileName.compare( fileName.length() - length, length,
+			extension ) == 0 );
+}
+
+bool HasJsonExtension( const string& fileName )
+{
+	return HasExtension( fileName, JsonExtension );
+}
+
+// returns the file name without .json extension
+string RemoveJsonExtension( const string& fileName )
+{
+	if( HasJsonExtension( fileName ) ) {
+		return fileName.substr( 0, fileName.length() - strlen( JsonExtension ) );
 	}
-	// set named entiry type for tokens
-	size_t offset = 0;
-	auto ti = tokens.begin();
-	for( auto i = answers.cbegin(); i != answers.cend(); ++i ) {
-		for( ; offset < i->first; ++ti ) {
-			AddTokenToOffset( *ti, offset );
-		}
+	return fileName;
+}
+
+// returns sorted files of the directory with the extension
+void ReadDirectory( const string& directory, vector<string>& fileNames,
+	const char* extension = JsonExtension )
+{
+	string path = directory;
+	if( path.find_last_of( "\\/" ) != path.length() - 1 ) {
+		path += "/";
+	}
+#ifdef _WIN32
+	WIN32_FIND_DATAA findData;
+	HANDLE find = FindFirstFileA( ( path + "*" + extension ).c_str(),
+		&findData );
+	if( find != INVALID_HANDLE_VALUE ) {
 		do {
-			AddTokenToOffset( *ti, offset );
-			if( !IsMark( ti->Type ) ) {
-				ti->NamedEntityType = i->second.second;
+			if( ( findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 ) {
+				fileNames.push_back( path + findData.cFileName );
 			}
-			ti++;
-		} while( offset < i->second.first );
+		} while( FindNextFileA( find, &findData ) != 0 );
+		FindClose( find );
+	}
+#else
+	DIR* dir = opendir( directory.c_str() );
+	if( dir == nullptr ) {
+		throw new CException( "Can't read directory '" + directory + "'" );
+	}
+	for( dirent* entry = readdir( dir ); entry != nullptr;
+		entry = readdir( dir ) )
+	{
+		const string fileName = path + entry->d_name;
+		if( HasExtension( fileName, extension ) && !IsDirectory( fileName ) ) {
+			fileNames.push_back( fileName );
+		}
 	}
+	closedir( dir );
+#endif
+	sort( fileNames.begin(), fileNames.end() );
 }
 
-string GetPath( const string& filename )
+// returns json files listed in the file, one per line
+void ReadFileList( const string& listFileName, vector<string>& fileNames )
 {
-	string::size_type i = filename.find_last_of( "\\/" );
-	if( i != string::npos ) {
-		return filename.substr( 0, i + 1 );
+	ifstream listFile( listFileName );
+	if( !listFile.good() ) {
+		throw new CException( "Can't open file '" + listFileName + "'" );
+	}
+	while( listFile.good() ) {
+		string fileName;
+		getline( listFile, fileName );
+		if( !fileName.empty() && fileName.back() == '\r' ) {
+			fileName.pop_back();
+		}
+		if( !fileName.empty() ) {
+			fileNames.push_back( fileName );
+		}
+	}
+}
+
+void OpenOutputFile( const string& fileName, ofstream& outputFile )
+{
+	outputFile.open( fileName, ios::out | ios::binary );
+	if( !outputFile.good() ) {
+		throw new CException( "Can't create file '" + fileName + "'" );
 	}
-	return "./";
 }
 
 //------------------------------------------------------------------------------
 
-// Concatenation rules:
-// -         ( ,    )   .
-// -   : ORG LOC,    ORG.
-// -   : ORG (.) PER,    ORG.
-class CConcatenator {
+// Thread pool with a deque of tasks per worker. A worker takes tasks
+// from the back of its own deque and steals tasks from the front of
+// deques of other workers when its own deque is empty.
+class CThreadPool {
 public:
-	static void Concatenate( const string& crfTestedFilename,
-		const CTokens& tokens, ostream& output );
+	// the index of the worker which runs the task
+	typedef function<void( size_t workerIndex )> TTask;
+
+	explicit CThreadPool( size_t numberOfThreads );
+	~CThreadPool();
+
+	size_t NumberOfThreads() const { return workers.size(); }
+
+	// adds the task to the deque of the worker,
+	// tasks added outside the workers are spread over all the deques
+	void AddTask( const TTask& task, size_t workerIndex );
+	void AddTask( const TTask& task );
 
 private:
-	CConcatenator( const string& crfTestedFilename,
-		const CTokens& tokens, ostream& ouput );
+	struct CTaskQueue {
+		mutex Mutex;
+		deque<TTask> Tasks;
+	};
+
+	vector<unique_ptr<CTaskQueue> > queues;
+	vector<thread> workers;
+	atomic<size_t> nextQueue;
+	mutex waitMutex;
+	condition_variable waitCondition;
+	size_t numberOfTasks; // guarded by waitMutex
+	bool isStopped; // guarded by waitMutex
+
+	void work( size_t workerIndex );
+	bool takeTask( size_t workerIndex, TTask& task );
+
+	CThreadPool( const CThreadPool& );
+	CThreadPool& operator=( const CThreadPool& );
+};
 
-	void startNe( TNamedEntityType type );
-	void endNe( TNamedEntityType type, bool ignoreLastWord = false );
-	bool parseLine( const string& line, string& text,
-		TNamedEntityType& type ) const;
-	void addToken( const string& token, TNamedEntityType type );
-	bool isSimpleDot() const;
+CThreadPool::CThreadPool( size_t numberOfThreads ) :
+	nextQueue( 0 ),
+	numberOfTasks( 0 ),
+	isStopped( false )
+{
+	assert( numberOfThreads > 0 );
+	for( size_t i = 0; i < numberOfThreads; i++ ) {
+		queues.push_back( unique_ptr<CTaskQueue>( new CTaskQueue ) );
+	}
+	for( size_t i = 0; i < numberOfThreads; i++ ) {
+		workers.push_back( thread( &CThreadPool::work, this, i ) );
+	}
+}
 
-	typedef void ( CConcatenator::*TState )( TNamedEntityType type );
+CThreadPool::~CThreadPool()
+{
+	{
+		lock_guard<mutex> lock( waitMutex );
+		isStopped = true;
+	}
+	waitCondition.notify_all();
+	for( auto i = workers.begin(); i != workers.end(); ++i ) {
+		i->join();
+	}
+}
 
-	void stateNone( TNamedEntityType type );
-	void stateOrg( TNamedEntityType type );
-	void stateOrgIm( TNamedEntityType type );
-	void stateOrgImeny( TNamedEntityType type );
-	void stateOrgImenyPerson( TNamedEntityType type );
-	void stateLoc( TNamedEntityType type );
-	void statePerson( TNamedEntityType type );
+void CThreadPool::AddTask( const TTask& task, size_t workerIndex )
+{
+	assert( workerIndex < queues.size() );
+	{
+		lock_guard<mutex> lock( queues[workerIndex]->Mutex );
+		queues[workerIndex]->Tasks.push_back( task );
+	}
+	{
+		lock_guard<mutex> lock( waitMutex );
+		numberOfTasks++;
+	}
+	waitCondition.notify_one();
+}
 
-	ifstream input;
-	ostream& output;
-	const CTokens& tokens;
-	size_t offset;
-	CTokens::const_iterator token;
-	size_t neOffset;
-	CTokens::const_iterator neToken;
+void CThreadPool::AddTask( const TTask& task )
+{
+	AddTask( task, nextQueue++ % queues.size() );
+}
 
-	TState state;
+void CThreadPool::work( size_t workerIndex )
+{
+	while( true ) {
+		{
+			unique_lock<mutex> lock( waitMutex );
+			while( !isStopped && numberOfTasks == 0 ) {
+				waitCondition.wait( lock );
+			}
+			if( numberOfTasks == 0 ) {
+				return; // stopped
+			}
+			numberOfTasks--;
+		}
+		// there is a task for this worker in one of the deques
+		TTask task;
+		while( !takeTask( workerIndex, task ) ) {
+			this_thread::yield();
+		}
+		task( workerIndex );
+	}
+}
+
+bool CThreadPool::takeTask( size_t workerIndex, TTask& task )
+{
+	{
+		CTaskQueue& queue = *queues[workerIndex];
+		lock_guard<mutex> lock( queue.Mutex );
+		if( !queue.Tasks.empty() ) {
+			task = queue.Tasks.back();
+			queue.Tasks.pop_back();
+			return true;
+		}
+	}
+	for( size_t i = 1; i < queues.size(); i++ ) {
+		CTaskQueue& queue = *queues[( workerIndex + i ) % queues.size()];
+		lock_guard<mutex> lock( queue.Mutex );
+		if( !queue.Tasks.empty() ) {
+			task = queue.Tasks.front();
+			queue.Tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+//------------------------------------------------------------------------------
+
+// Processes documents by a thread pool. Signs of a large document are
+// prepared by several tasks, the document is split at ends of sentences.
+// Outputs of documents are written in input order by the calling thread.
+class CBatchProcessor {
+public:
+	// reads tokens of the document (and answers)
+	typedef function<void( const string& jsonFileName,
+		CTokens& tokens )> TReadDocument;
+	// makes output of the document by lines of signs of its tokens
+	typedef function<void( size_t workerIndex, const CTokens& tokens,
+		string& signsLines, string& output )> TFinishDocument;
+	// returns output file name of the document
+	typedef function<string( const string& jsonFileName )> TOutputFileName;
+
+	CBatchProcessor( size_t numberOfThreads, const CBaseSigns& signs );
+
+	size_t NumberOfThreads() const { return pool.NumberOfThreads(); }
+
+	// An error in a document doesn't stop processing of other documents
+	void Process( const string& directoryOrList,
+		const TReadDocument& readDocument,
+		const TFinishDocument& finishDocument,
+		const TOutputFileName& outputFileName );
+
+private:
+	struct CDocument {
+		string FileName;
+		CTokens Tokens;
+		vector<string> ChunksSignsLines;
+		atomic<size_t> NumberOfUnfinishedChunks;
+		string Output;
+		string ErrorMessage; // guarded by errorMutex
+		bool IsFinished; // guarded by finishMutex
+	};
+
+	const CBaseSigns& signs;
+	TReadDocument readDocument;
+	TFinishDocument finishDocument;
+	vector<unique_ptr<CDocument> > documents;
+	mutex errorMutex;
+	mutex finishMutex;
+	condition_variable finishCondition;
+	CThreadPool pool;
+
+	void readTask( size_t workerIndex, CDocument& document );
+	void chunkTask( size_t workerIndex, CDocument& document,
+		size_t chunkIndex, size_t begin, size_t end );
+	void finishTask( size_t workerIndex, CDocument& document );
+	void setError( CDocument& document, const string& errorMessage );
+	void setFinished( CDocument& document );
+	template<typename TFunction>
+	bool runTask( CDocument& document, const TFunction& function );
 };
 
-void CConcatenator::Concatenate( const string& crfTestedFilename,
-		const CTokens& tokens, ostream& output )
+CBatchProcessor::CBatchProcessor( size_t numberOfThreads,
+		const CBaseSigns& _signs ) :
+	signs( _signs ),
+	pool( numberOfThreads == 0 ? 1 : numberOfThreads )
 {
-	CConcatenator concatenate( crfTestedFilename, tokens, output );
 }
 
-CConcatenator::CConcatenator( const string& crfTestedFilename,
-		const CTokens& _tokens, ostream& _output ):
-	input( crfTestedFilename, ios::in ),
-	output( _output ),
-	tokens( _tokens ),
-	offset( 0 ),
-	token( tokens.cbegin() ),
-	neOffset( 0 ),
-	neToken( tokens.cend() ),
-	state( &CConcatenator::stateNone )
+void CBatchProcessor::Process( const string& directoryOrList,
+	const TReadDocument& _readDocument,
+	const TFinishDocument& _finishDocument,
+	const TOutputFileName& outputFileName )
 {
-	if( !input.good() ) {
-		throw new CException( "Crf tested file '"
-			+ crfTestedFilename + "' not found" );
+	readDocument = _readDocument;
+	finishDocument = _finishDocument;
+
+	vector<string> fileNames;
+	if( IsDirectory( directoryOrList ) ) {
+		ReadDirectory( directoryOrList, fileNames );
+	} else {
+		ReadFileList( directoryOrList, fileNames );
 	}
 
-	string line;
-	string text;
-	TNamedEntityType type;
-	while( input.good() ) {
-		getline( input, line );
-		if( !line.empty() && line.back() == '\r' ) {
-			line.pop_back();
+	documents.clear();
+	documents.resize( fileNames.size() );
+	// limits the number of documents kept in memory
+	const size_t maxNumberOfDocuments = 4 * pool.NumberOfThreads();
+	size_t numberOfStarted = 0;
+	size_t numberOfErrors = 0;
+	for( size_t i = 0; i < fileNames.size(); i++ ) {
+		for( ; numberOfStarted < fileNames.size()
+			&& numberOfStarted < i + maxNumberOfDocuments; numberOfStarted++ )
+		{
+			CDocument* document = new CDocument;
+			document->FileName = fileNames[numberOfStarted];
+			document->NumberOfUnfinishedChunks = 0;
+			document->IsFinished = false;
+			documents[numberOfStarted].reset( document );
+			pool.AddTask( [this, document]( size_t workerIndex ) {
+				readTask( workerIndex, *document );
+			} );
 		}
-		if( line.empty() ) {
-			continue;
+
+		CDocument& document = *documents[i];
+		{
+			unique_lock<mutex> lock( finishMutex );
+			while( !document.IsFinished ) {
+				finishCondition.wait( lock );
+			}
 		}
-		if( !parseLine( line, text, type ) ) {
-			input.clear();
-			input.setstate( ios::failbit );
-			break;
+		if( document.ErrorMessage.empty() ) {
+			try {
+				ofstream output;
+				OpenOutputFile( outputFileName( document.FileName ), output );
+				output.write( document.Output.data(), document.Output.length() );
+			} catch( CException* e ) {
+				document.ErrorMessage = e->Message();
+				e->Delete();
+			}
 		}
-		addToken( text, type );
+		if( !document.ErrorMessage.empty() ) {
+			cerr << "Error: " << document.FileName << ": "
+				<< document.ErrorMessage << "." << endl;
+			numberOfErrors++;
+		}
+		documents[i].reset();
 	}
-	if( !input.eof() && input.fail() ) {
-		throw new CException( "Bad crf tested file '"
-			+ crfTestedFilename + "' format" );
+
+	if( numberOfErrors > 0 ) {
+		ostringstream message;
+		message << numberOfErrors << " of " << fileNames.size()
+			<< " documents are not processed";
+		throw new CException( message.str() );
 	}
 }
 
-void CConcatenator::startNe( TNamedEntityType type )
+void CBatchProcessor::readTask( size_t workerIndex, CDocument& document )
 {
-	if( type == NET_None ) {
-		state = &CConcatenator::stateNone;
+	vector<pair<size_t, size_t> > chunks;
+	const bool success = runTask( document, [&]() {
+		readDocument( document.FileName, document.Tokens );
+		SplitIntoChunks( document.Tokens, chunks );
+	} );
+	if( !success || chunks.empty() ) {
+		setFinished( document );
 		return;
 	}
 
-	neOffset = offset;
-	neToken = token;
-
-	if( type == NET_Org ) {
-		state = &CConcatenator::stateOrg;
-	} else if( type == NET_Loc ) {
-		state = &CConcatenator::stateLoc;
-	} else if( type == NET_Person ) {
-		state = &CConcatenator::statePerson;
-	} else {
-		assert( false );
+	document.ChunksSignsLines.resize( chunks.size() );
+	document.NumberOfUnfinishedChunks = chunks.size();
+	// the first chunk is prepared by this worker, others can be stolen
+	CDocument* documentPtr = &document;
+	for( size_t i = chunks.size() - 1; i > 0; i-- ) {
+		const pair<size_t, size_t> chunk = chunks[i];
+		pool.AddTask( [this, documentPtr, i, chunk]( size_t worker ) {
+			chunkTask( worker, *documentPtr, i, chunk.first, chunk.second );
+		}, workerIndex );
 	}
+	chunkTask( workerIndex, document, 0, chunks[0].first, chunks[0].second );
 }
 
-void CConcatenator::endNe( TNamedEntityType type, bool ignoreLastWord )
+void CBatchProcessor::chunkTask( size_t workerIndex, CDocument& document,
+	size_t chunkIndex, size_t begin, size_t end )
 {
-	assert( neToken != tokens.cend() );
-	if( type == NET_Org ) {
-		output << "ORG";
-	} else if( type == NET_Loc ) {
-		output << "LOC";
-	} else if( type == NET_Person ) {
-		output << "PER";
-	} else {
-		assert( false );
-	}
-	string text;
-
-	auto end = token;
-	do {
-		--end;
-	} while( !IsWord( end->Type ) );
-	if( ignoreLastWord ) {
-		do {
-			--end;
-		} while( !IsWord( end->Type ) );
+	runTask( document, [&]() {
+		PrepareSigns( signs, document.Tokens, begin, end,
+			document.ChunksSignsLines[chunkIndex] );
+	} );
+	if( --document.NumberOfUnfinishedChunks == 0 ) {
+		finishTask( workerIndex, document );
 	}
-	++end;
+}
 
-	for( auto i = neToken; i != end; ++i ) {
-		if( i->Type == TT_Text || IsWord( i->Type ) ) {
-			text += i->Text;
+void CBatchProcessor::finishTask( size_t workerIndex, CDocument& document )
+{
+	{
+		lock_guard<mutex> lock( errorMutex );
+		if( !document.ErrorMessage.empty() ) {
+			setFinished( document );
+			return;
 		}
 	}
-	output << " " << neOffset << " " << text.length() << endl;
-		//<< " #{" << text << "}" << endl;
-	neToken = tokens.cend();
+	runTask( document, [&]() {
+		string signsLines;
+		for( auto i = document.ChunksSignsLines.begin();
+			i != document.ChunksSignsLines.end(); ++i )
+		{
+			signsLines += *i;
+			string().swap( *i );
+		}
+		finishDocument( workerIndex, document.Tokens, signsLines,
+			document.Output );
+	} );
+	setFinished( document );
 }
 
-bool CConcatenator::parseLine( const string& line, string& text,
-	TNamedEntityType& type ) const
+void CBatchProcessor::setError( CDocument& document,
+	const string& errorMessage )
 {
-	text.clear();
-	type = NET_None;
+	lock_guard<mutex> lock( errorMutex );
+	if( document.ErrorMessage.empty() ) {
+		document.ErrorMessage = errorMessage;
+	}
+}
 
-	string::size_type textEndPos = line.find( '\t' );
-	string::size_type neBeginPos = line.rfind( '\t' );
+// the document can be destroyed by the main thread right after the call
+void CBatchProcessor::setFinished( CDocument& document )
+{
+	{
+		lock_guard<mutex> lock( finishMutex );
+		document.IsFinished = true;
+	}
+	finishCondition.notify_all();
+}
 
-	if( textEndPos == string::npos || neBeginPos == string::npos ) {
-		return false;
+// errors of a task are saved in the document
+template<typename TFunction>
+bool CBatchProcessor::runTask( CDocument& document,
+	const TFunction& function )
+{
+	try {
+		function();
+		return true;
+	} catch( CException* e ) {
+		setError( document, e->Message() );
+		e->Delete();
+	} catch( exception& e ) {
+		setError( document, string( "std::exception: " ) + e.what() );
+	} catch( ... ) {
+		setError( document, "Unhandled exception" );
 	}
+	return false;
+}
 
-	text = line.substr( 0, textEndPos );
-	if( text.empty() ) {
-		return false;
+size_t GetNumberOfThreads( const char* argument )
+{
+	if( argument == nullptr ) {
+		const size_t numberOfThreads = thread::hardware_concurrency();
+		return ( numberOfThreads > 0 ? numberOfThreads : 1 );
 	}
+	istringstream iss( argument );
+	size_t numberOfThreads = 0;
+	iss >> numberOfThreads;
+	if( iss.fail() || !iss.eof() || numberOfThreads == 0 ) {
+		throw new CException( string( "Bad number of threads '" )
+			+ argument + "'" );
+	}
+	return numberOfThreads;
+}
 
-	string typeText = line.substr( neBeginPos + 1 );
+//------------------------------------------------------------------------------
 
-	if( typeText == "Org" ) {
-		type = NET_Org;
-	} else if( typeText == "Loc" ) {
-		type = NET_Loc;
-	} else if( typeText == "Person" ) {
-		type = NET_Person;
-	} else if( typeText != "NO" ) {
-		return false;
-	}
+void PrepareTestDir( const char* argv[] )
+{
+	unique_ptr<CBaseSigns> signs(
+		CreateSigns( GetPath( argv[0] ) + AuxFileRelativePath ) );
+	CBatchProcessor processor( GetNumberOfThreads( argv[3] ), *signs );
+	processor.Process( argv[2],
+		[]( const string& jsonFileName, CTokens& tokens ) {
+			ReadTokens( jsonFileName, tokens, true );
+		},
+		[]( size_t, const CTokens&, string& signsLines, string& output ) {
+			output.swap( signsLines );
+		},
+		[]( const string& jsonFileName ) {
+			return RemoveJsonExtension( jsonFileName ) + SignsExtension;
+		} );
+	PrintLexCacheStatistics( *signs );
+}
 
-	return true;
+//------------------------------------------------------------------------------
+
+void PrepareTrainDir( const char* argv[] )
+{
+	unique_ptr<CBaseSigns> signs(
+		CreateSigns( GetPath( argv[0] ) + AuxFileRelativePath ) );
+	CBatchProcessor processor( GetNumberOfThreads( argv[3] ), *signs );
+	processor.Process( argv[2],
+		[]( const string& jsonFileName, CTokens& tokens ) {
+			ReadTokens( jsonFileName, tokens );
+			ReadAnswer( jsonFileName + AnswerExtension, tokens );
+		},
+		[]( size_t, const CTokens&, string& signsLines, string& output ) {
+			output.swap( signsLines );
+		},
+		[]( const string& jsonFileName ) {
+			return jsonFileName + SignsExtension;
+		} );
+	PrintLexCacheStatistics( *signs );
 }
 
-void CConcatenator::addToken( const string& text, TNamedEntityType type )
+//------------------------------------------------------------------------------
+
+void RecognizeDir( const char* argv[] )
 {
-	while( token != tokens.cend() && !IsWordOrMark( token->Type ) ) {
-		AddTokenToOffset( *token, offset );
-		++token;
+	const string path = GetPath( argv[0] );
+	CRecognizer recognizer( path + AuxFileRelativePath,
+		path + ModelRelativePath );
+	const shared_ptr<const CBaseSigns> signs = recognizer.Signs();
+	CBatchProcessor processor( GetNumberOfThreads( argv[3] ), *signs );
+	vector<unique_ptr<CRFPP::Tagger> > taggers;
+	for( size_t i = 0; i < processor.NumberOfThreads(); i++ ) {
+		taggers.push_back( unique_ptr<CRFPP::Tagger>(
+			recognizer.CreateTagger() ) );
 	}
+	processor.Process( argv[2],
+		[]( const string& jsonFileName, CTokens& tokens ) {
+			ReadTokens( jsonFileName, tokens );
+		},
+		[&]( size_t workerIndex, const CTokens& tokens,
+			string& signsLines, string& output )
+		{
+			output.clear();
+			CStringOutput task1( output );
+			recognizer.Recognize( *taggers[workerIndex], tokens,
+				signsLines, task1 );
+			task1.Flush();
+		},
+		[]( const string& jsonFileName ) {
+			return RemoveJsonExtension( jsonFileName ) + Task1Extension;
+		} );
+	PrintLexCacheStatistics( *signs );
+}
 
-	assert( token != tokens.cend() );
-	assert( IsWordOrMark( token->Type ) );
+//------------------------------------------------------------------------------
 
-	if( text != token->Text ) {
-		throw new CException( "Json or tested file(s) is(are) corrupted" );
+// Compiles all text lists of the aux files directory into one bundle
+// (see CGazetteersBundleHeader)
+void WriteGazetteersBundle( const string& auxFilesPath,
+	const string& bundleFileName )
+{
+	// aux files are the files of the directory with the name prefix
+	const size_t slash = auxFilesPath.find_last_of( "\\/" );
+	const string directory = ( slash == string::npos ) ?
+		string( "." ) : auxFilesPath.substr( 0, slash + 1 );
+	const string prefix = ( slash == string::npos ) ?
+		auxFilesPath : auxFilesPath.substr( slash + 1 );
+	vector<string> fileNames;
+	ReadDirectory( directory, fileNames, TextExtension );
+	vector<string> names;
+	for( auto i = fileNames.cbegin(); i != fileNames.cend(); ++i ) {
+		const string fileName = i->substr( i->find_last_of( "\\/" ) + 1 );
+		if( fileName.compare( 0, prefix.length(), prefix ) == 0 ) {
+			names.push_back( fileName.substr( prefix.length() ) );
+		}
+	}
+	if( names.empty() ) {
+		throw new CException( "There are no aux files in directory '"
+			+ directory + "'" );
+	}
+	if( names.size() > GazetteersBundleMaxNumberOfLists ) {
+		throw new CException( "Too many aux files in directory '"
+			+ directory + "'" );
 	}
 
-	( this->*state )( type );
-	AddTokenToOffset( *token, offset );
-	++token;
+	CGazetteersBundleHeader header;
+	memset( &header, 0, sizeof( header ) );
+	memcpy( header.Magic, GazetteersBundleMagic, sizeof( GazetteersBundleMagic ) );
+	header.Version = GazetteersBundleVersion;
+	header.NumberOfLists = static_cast<uint32_t>( names.size() );
+	vector<CGazetteersBundleList> lists( names.size() );
+	vector<CGazetteersBundleString> strings;
+	string blob;
+	map<string, uint32_t> wordMasks;
+	for( size_t i = 0; i < names.size(); i++ ) {
+		const string fileName = auxFilesPath + names[i];
+		CGazetteersBundleList& list = lists[i];
+		memset( &list, 0, sizeof( list ) );
+		if( !GetFileSizeAndTime( fileName,
+			list.SourceSize, list.SourceModificationTime ) )
+		{
+			throw new CException( "Can't open file '" + fileName + "'" );
+		}
+		list.NameOffset = static_cast<uint32_t>( blob.length() );
+		list.NameLength = static_cast<uint32_t>( names[i].length() );
+		blob += names[i];
+
+		unordered_set<string> words;
+		ReadWordsFile( fileName, words );
+		vector<string> sortedWords( words.cbegin(), words.cend() );
+		sort( sortedWords.begin(), sortedWords.end() );
+		list.FirstWord = strings.size();
+		list.NumberOfWords = sortedWords.size();
+		for( auto word = sortedWords.cbegin(); word != sortedWords.cend();
+			++word )
+		{
+			CGazetteersBundleString str;
+			str.Offset = blob.length();
+			str.Length = static_cast<uint32_t>( word->length() );
+			str.Reserved = 0;
+			strings.push_back( str );
+			blob += *word;
+			wordMasks[*word] |= 1U << i;
+		}
+	}
+	TGazetteersTrie trie;
+	BuildGazetteersTrie( wordMasks, trie );
+	header.NumberOfWords = strings.size();
+	header.TrieSize = trie.total_size();
+	header.BlobSize = blob.length();
+
+	string data;
+	data.append( reinterpret_cast<const char*>( lists.data() ),
+		lists.size() * sizeof( CGazetteersBundleList ) );
+	data.append( reinterpret_cast<const char*>( strings.data() ),
+		strings.size() * sizeof( CGazetteersBundleString ) );
+	data.append( static_cast<const char*>( trie.array() ), trie.total_size() );
+	data += blob;
+	header.Checksum = Fnv1aHash( data.data(), data.length() );
+
+	vector<CStringRef> parts;
+	parts.push_back( CStringRef( reinterpret_cast<const char*>( &header ),
+		sizeof( header ) ) );
+	parts.push_back( CStringRef( data.data(), data.length() ) );
+	if( !WriteFileByRename( bundleFileName, parts ) ) {
+		throw new CException( "Can't create file '" + bundleFileName + "'" );
+	}
 }
 
-bool CConcatenator::isSimpleDot() const
+// Checks all the contents of the bundle, it takes time proportional
+// to the size of the bundle, so the modes check only its header
+void VerifyGazetteersBundle( const string& bundleFileName )
 {
-	return ( token->Type == TT_Dot && !token->IsEndOfSentence );
+	CMappedFile file( bundleFileName );
+	if( !CheckGazetteersBundleHeader( file ) ) {
+		throw new CException( "Gazetteers bundle '" + bundleFileName
+			+ "' has a bad header" );
+	}
+	const CGazetteersBundleHeader* header =
+		reinterpret_cast<const CGazetteersBundleHeader*>( file.Data() );
+	if( header->Checksum != Fnv1aHash(
+		file.Data() + sizeof( CGazetteersBundleHeader ),
+		file.Size() - sizeof( CGazetteersBundleHeader ) ) )
+	{
+		throw new CException( "Gazetteers bundle '" + bundleFileName
+			+ "' is damaged" );
+	}
+	const CGazetteersBundleList* lists =
+		reinterpret_cast<const CGazetteersBundleList*>( header + 1 );
+	const CGazetteersBundleString* strings =
+		reinterpret_cast<const CGazetteersBundleString*>(
+			lists + header->NumberOfLists );
+	for( uint64_t i = 0; i < header->NumberOfWords; i++ ) {
+		if( strings[i].Offset + strings[i].Length > header->BlobSize ) {
+			throw new CException( "Gazetteers bundle '" + bundleFileName
+				+ "' has a word out of its blob" );
+		}
+	}
 }
 
-void CConcatenator::stateNone( TNamedEntityType type )
+void CompileGazetteers( const char* argv[] )
 {
-	startNe( type );
+	const string auxFilesPath = GetPath( argv[0] ) + AuxFileRelativePath;
+	const string bundleFileName = ( argv[2] != nullptr ) ?
+		string( argv[2] ) : auxFilesPath + GazetteersBundleFileName;
+	WriteGazetteersBundle( auxFilesPath, bundleFileName );
+	VerifyGazetteersBundle( bundleFileName );
 }
 
-void CConcatenator::stateOrg( TNamedEntityType type )
+void VerifyGazetteers( const char* argv[] )
 {
-	if( type == NET_None ) {
-		if( token->Text == "" ) { // TODO: compare case insensitive
-			state = &CConcatenator::stateOrgIm;
-		} else if( token->Text == "" ) { // TODO: compare case insensitive
-			state = &CConcatenator::stateOrgImeny;
-		} else if( !isSimpleDot() ) {
-			endNe( NET_Org );
-			startNe( type );
-		}
-	} else if( type != NET_Org && !isSimpleDot() ) {
-		endNe( NET_Org );
-		startNe( type );
+	const string auxFilesPath = GetPath( argv[0] ) + AuxFileRelativePath;
+	const string bundleFileName = ( argv[2] != nullptr ) ?
+		string( argv[2] ) : auxFilesPath + GazetteersBundleFileName;
+	VerifyGazetteersBundle( bundleFileName );
+	CAuxFiles auxFiles( auxFilesPath );
+	if( bundleFileName == auxFilesPath + GazetteersBundleFileName
+		&& !auxFiles.HasBundle() )
+	{
+		throw new CException( "Gazetteers bundle '" + bundleFileName
+			+ "' is valid, but it is older than the aux files" );
 	}
+	cerr << "Gazetteers bundle '" << bundleFileName << "' is valid." << endl;
 }
 
-void CConcatenator::stateOrgIm( TNamedEntityType type )
+//------------------------------------------------------------------------------
+// Daemon mode: signs and crf model are loaded once and each connection
+// to the unix domain socket is one request. A client sends mystem json
+// of a text and shuts down writing, the server replies with task1 lines
+// of the text (or with one "ERROR message" line) and closes the connection.
+// SIGHUP reloads auxiliary files in background without stopping requests.
+
+#ifdef _WIN32
+
+void Serve( const char* /* argv */[] )
 {
-	if( token->Type == TT_Dot ) {
-		state = &CConcatenator::stateOrgImeny;
-	} else {
-		endNe( NET_Org, true );
-		startNe( type );
-	}
+	throw new CException( "--serve is not supported on Windows" );
 }
 
-void CConcatenator::stateOrgImeny( TNamedEntityType type )
+#else
+
+const int ServeListenBacklog = 128;
+// a client which does not send its whole request in time gets an error
+const int ServeReceiveTimeout = 1000; // milliseconds
+// longer requests get an error
+const size_t ServeMaxRequestSize = 64 * 1024 * 1024;
+// more connections waiting for a worker are refused at once
+const size_t ServeMaxWaitingConnectionsPerThread = 4;
+
+// signal handlers wake up poll of the main thread by the pipe,
+// so a signal is not lost between checking of the flags and poll
+int ServeWakeUpPipe[2] = { -1, -1 };
+
+void WakeUpServe()
 {
-	if( type != NET_Person ) {
-		endNe( NET_Org, true );
-		startNe( type );
-	} else {
-		state = &CConcatenator::stateOrgImenyPerson;
+	const int savedErrno = errno;
+	const char byte = 0;
+	if( write( ServeWakeUpPipe[1], &byte, 1 ) == -1 ) {
+		// the pipe is full, so poll is woken up anyway
 	}
+	errno = savedErrno;
 }
 
-void CConcatenator::stateOrgImenyPerson( TNamedEntityType type )
+volatile sig_atomic_t IsServeStopped = 0;
+
+void StopServe( int )
 {
-	if( type != NET_Person && !isSimpleDot() ) {
-		endNe( NET_Org );
-		startNe( type );
-	}
+	IsServeStopped = 1;
+	WakeUpServe();
 }
 
-void CConcatenator::stateLoc( TNamedEntityType type )
+volatile sig_atomic_t IsServeReloadRequested = 0;
+
+void RequestServeReload( int )
 {
-	if( type != NET_Loc && !isSimpleDot() ) {
-		endNe( NET_Loc );
-		startNe( type );
-	}
+	IsServeReloadRequested = 1;
+	WakeUpServe();
 }
 
-void CConcatenator::statePerson( TNamedEntityType type )
+bool SetNonBlocking( int fd, bool isNonBlocking )
 {
-	if( type != NET_Person && !isSimpleDot() ) {
-		endNe( NET_Person );
-		startNe( type );
-	}
+	const int flags = fcntl( fd, F_GETFL );
+	return ( flags != -1 && fcntl( fd, F_SETFL, isNonBlocking ?
+		( flags | O_NONBLOCK ) : ( flags & ~O_NONBLOCK ) ) != -1 );
 }
 
-//------------------------------------------------------------------------------
-
-void PrepareSigns( const string& auxFilesPath, const CTokens& tokens )
+void ReloadServeSigns( CRecognizer& recognizer )
 {
-	// intialize token signs
-	CSigns signs;
-	InitializeSigns( signs, auxFilesPath );
+	try {
+		recognizer.ReloadSigns();
+		cerr << "Auxiliary files are reloaded" << endl;
+	} catch( CException* e ) {
+		cerr << "Can't reload auxiliary files: " << e->Message() << endl;
+		e->Delete();
+	} catch( exception& e ) {
+		cerr << "Can't reload auxiliary files: std::exception: "
+			<< e.what() << endl;
+	}
+}
 
-	for( auto i = tokens.cbegin(); i != tokens.cend(); ++i ) {
-		assert( i->Type != TT_None );
-		if( i->Type == TT_Text ) {
+// returns false if the client has gone
+bool ReceiveRequest( int connection, string& request )
+{
+	const chrono::steady_clock::time_point deadline =
+		chrono::steady_clock::now() + chrono::milliseconds( ServeReceiveTimeout );
+	char buffer[64 * 1024];
+	while( true ) {
+		const long long timeLeft = chrono::duration_cast<chrono::milliseconds>(
+			deadline - chrono::steady_clock::now() ).count();
+		pollfd connectionPoll = { connection, POLLIN, 0 };
+		const int ready = timeLeft > 0 ?
+			poll( &connectionPoll, 1, static_cast<int>( timeLeft ) ) : 0;
+		if( ready == 0 ) {
+			throw new CException( "Request is not received in time" );
+		} else if( ready == -1 ) {
+			if( errno != EINTR ) {
+				return false;
+			}
 			continue;
 		}
-		string line;
-		signs.Apply( *i, line );
-		cout << line << endl;
+		const ssize_t received = recv( connection, buffer, sizeof( buffer ), 0 );
+		if( received > 0 ) {
+			if( request.length() + static_cast<size_t>( received )
+				> ServeMaxRequestSize )
+			{
+				ostringstream message;
+				message << "Request is longer than "
+					<< ServeMaxRequestSize << " bytes";
+				throw new CException( message.str() );
+			}
+			request.append( buffer, static_cast<size_t>( received ) );
+		} else if( received == 0 ) {
+			return true;
+		} else if( errno != EINTR && errno != EAGAIN ) {
+			return false;
+		}
 	}
 }
 
-//------------------------------------------------------------------------------
-
-void PrepareTestFile( const char* argv[] )
+void SendReply( int connection, const string& reply )
 {
-	CTokens tokens;
-	ReadTokens( argv[2], tokens );
-	PrepareSigns( GetPath( argv[0] ) + AuxFileRelativePath, tokens );
+	for( size_t sent = 0; sent < reply.length(); ) {
+		const ssize_t result = send( connection, reply.data() + sent,
+			reply.length() - sent, 0 );
+		if( result >= 0 ) {
+			sent += static_cast<size_t>( result );
+		} else if( errno != EINTR ) {
+			return; // the client has gone
+		}
+	}
 }
 
-//------------------------------------------------------------------------------
-
-void PrepareTrainFile( const char* argv[] )
+void ServeConnection( int connection, const CRecognizer& recognizer,
+	CRFPP::Tagger& tagger )
 {
-	CTokens tokens;
-	ReadTokens( argv[2], tokens );
-	ReadAnswer( argv[3], tokens );
-	PrepareSigns( GetPath( argv[0] ) + AuxFileRelativePath, tokens );
+	string reply;
+	try {
+		string request;
+		if( ReceiveRequest( connection, request ) ) {
+			CTokens tokens;
+			ReadTokensFromJson(
+				shared_ptr<CTextBuffer>( new CStringBuffer( request ) ),
+				"request", tokens );
+			if( tokens.IsEmpty() ) {
+				throw new CException( "There are no tokens in request" );
+			}
+			// the reply is replaced by the error message on exception
+			CStringOutput output( reply );
+			recognizer.Recognize( tagger, tokens, output );
+			output.Flush();
+		}
+	} catch( CException* e ) {
+		reply = "ERROR " + e->Message() + "\n";
+		e->Delete();
+	} catch( exception& e ) {
+		reply = string( "ERROR std::exception: " ) + e.what() + "\n";
+	}
+	SendReply( connection, reply );
+	close( connection );
 }
 
-//------------------------------------------------------------------------------
+// the main thread does not wait for the client
+void RefuseConnection( int connection )
+{
+	static const char reply[] = "ERROR Server is busy\n";
+	if( send( connection, reply, sizeof( reply ) - 1, MSG_DONTWAIT ) == -1 ) {
+		// the client will see the closed connection
+	}
+	close( connection );
+}
 
-void PrepareAnswerFile( const char* argv[] )
+void Serve( const char* argv[] )
 {
-	CTokens tokens;
-	ReadTokens( argv[2], tokens );
-	CConcatenator::Concatenate( argv[3], tokens, cout );
+	const string path = GetPath( argv[0] );
+	CRecognizer recognizer( path + AuxFileRelativePath,
+		path + ModelRelativePath );
+
+	const string socketPath( argv[2] );
+	sockaddr_un address;
+	memset( &address, 0, sizeof( address ) );
+	address.sun_family = AF_UNIX;
+	if( socketPath.length() >= sizeof( address.sun_path ) ) {
+		throw new CException( "Socket path '" + socketPath + "' is too long" );
+	}
+	strcpy( address.sun_path, socketPath.c_str() );
+	// socket of the previous run of the server
+	struct stat socketStat;
+	if( stat( socketPath.c_str(), &socketStat ) == 0
+		&& S_ISSOCK( socketStat.st_mode ) )
+	{
+		unlink( socketPath.c_str() );
+	}
+	const int listener = socket( AF_UNIX, SOCK_STREAM, 0 );
+	if( listener == -1
+		|| bind( listener, reinterpret_cast<sockaddr*>( &address ),
+			sizeof( address ) ) != 0
+		|| listen( listener, ServeListenBacklog ) != 0
+		|| !SetNonBlocking( listener, true ) )
+	{
+		const string error = strerror( errno );
+		if( listener != -1 ) {
+			close( listener );
+		}
+		throw new CException( "Can't listen on socket '" + socketPath
+			+ "': " + error );
+	}
+	if( pipe( ServeWakeUpPipe ) != 0
+		|| !SetNonBlocking( ServeWakeUpPipe[0], true )
+		|| !SetNonBlocking( ServeWakeUpPipe[1], true ) )
+	{
+		const string error = strerror( errno );
+		close( listener );
+		throw new CException( "Can't create pipe: " + error );
+	}
+
+	// stop and reload signals are handled by the main thread,
+	// so workers and the reloader inherit the mask with the blocked signals
+	sigset_t serveSignals;
+	sigemptyset( &serveSignals );
+	sigaddset( &serveSignals, SIGINT );
+	sigaddset( &serveSignals, SIGTERM );
+	sigaddset( &serveSignals, SIGHUP );
+	pthread_sigmask( SIG_BLOCK, &serveSignals, nullptr );
+	signal( SIGPIPE, SIG_IGN );
+
+	string error;
+	vector<unique_ptr<CRFPP::Tagger> > taggers;
+	thread reloader;
+	atomic<bool> isReloading( false );
+	// accepted connections which are not taken by workers
+	atomic<size_t> numberOfWaitingConnections( 0 );
+	{
+		CThreadPool pool( GetNumberOfThreads( argv[3] ) );
+		for( size_t i = 0; i < pool.NumberOfThreads(); i++ ) {
+			taggers.push_back( unique_ptr<CRFPP::Tagger>(
+				recognizer.CreateTagger() ) );
+		}
+
+		const size_t maxWaitingConnections =
+			pool.NumberOfThreads() * ServeMaxWaitingConnectionsPerThread;
+
+		struct sigaction stopAction;
+		memset( &stopAction, 0, sizeof( stopAction ) );
+		stopAction.sa_handler = StopServe;
+		sigaction( SIGINT, &stopAction, nullptr );
+		sigaction( SIGTERM, &stopAction, nullptr );
+		struct sigaction reloadAction;
+		memset( &reloadAction, 0, sizeof( reloadAction ) );
+		reloadAction.sa_handler = RequestServeReload;
+		sigaction( SIGHUP, &reloadAction, nullptr );
+		pthread_sigmask( SIG_UNBLOCK, &serveSignals, nullptr );
+
+		cerr << "Serving on socket '" << socketPath << "'" << endl;
+		pollfd polls[2] = {
+			{ listener, POLLIN, 0 },
+			{ ServeWakeUpPipe[0], POLLIN, 0 }
+		};
+		while( IsServeStopped == 0 ) {
+			if( IsServeReloadRequested != 0 && !isReloading ) {
+				IsServeReloadRequested = 0;
+				if( reloader.joinable() ) {
+					reloader.join();
+				}
+				isReloading = true;
+				pthread_sigmask( SIG_BLOCK, &serveSignals, nullptr );
+				reloader = thread( [&recognizer, &isReloading]() {
+					ReloadServeSigns( recognizer );
+					isReloading = false;
+					// for a reload requested during this one
+					WakeUpServe();
+				} );
+				pthread_sigmask( SIG_UNBLOCK, &serveSignals, nullptr );
+			}
+			if( poll( polls, 2, -1 ) == -1 ) {
+				if( errno != EINTR ) {
+					error = strerror( errno );
+					break;
+				}
+				continue;
+			}
+			if( polls[1].revents != 0 ) {
+				char bytes[64];
+				while( read( ServeWakeUpPipe[0], bytes, sizeof( bytes ) ) > 0 ) {
+				}
+			}
+			if( polls[0].revents == 0 ) {
+				continue;
+			}
+			const int connection = accept( listener, nullptr, nullptr );
+			if( connection == -1 ) {
+				if( errno == EMFILE || errno == ENFILE
+					|| errno == ENOBUFS || errno == ENOMEM )
+				{
+					// wait for the running requests to release resources
+					this_thread::sleep_for( chrono::milliseconds( 100 ) );
+				} else if( errno != EINTR && errno != ECONNABORTED
+					&& errno != EAGAIN && errno != EWOULDBLOCK )
+				{
+					error = strerror( errno );
+					break;
+				}
+				continue;
+			}
+			if( numberOfWaitingConnections >= maxWaitingConnections ) {
+				RefuseConnection( connection );
+				continue;
+			}
+			// the connection may inherit O_NONBLOCK of the listener
+			SetNonBlocking( connection, false );
+			numberOfWaitingConnections++;
+			pool.AddTask( [&recognizer, &taggers, &numberOfWaitingConnections,
+				connection]( size_t workerIndex )
+			{
+				numberOfWaitingConnections--;
+				ServeConnection( connection, recognizer, *taggers[workerIndex] );
+			} );
+		}
+		// the pool finishes the accepted requests
+	}
+	if( reloader.joinable() ) {
+		reloader.join();
+	}
+	close( listener );
+	unlink( socketPath.c_str() );
+	// handlers must not write to a closed descriptor
+	const int wakeUpPipe[2] = { ServeWakeUpPipe[0], ServeWakeUpPipe[1] };
+	ServeWakeUpPipe[0] = ServeWakeUpPipe[1] = -1;
+	close( wakeUpPipe[0] );
+	close( wakeUpPipe[1] );
+	recognizer.PrintLexCacheStatistics();
+	if( !error.empty() ) {
+		throw new CException( "Can't accept connection on socket '"
+			+ socketPath + "': " + error );
+	}
 }
 
+#endif
+
 //------------------------------------------------------------------------------
 
 typedef void ( *StartupFunctionPtr )( const char* argv[] );
 
+// optional arguments are the last ones, argv[argc] is nullptr
 struct StartupMode {
 	const char* FirstArgument;
 	int NumberOfArguments;
+	int NumberOfOptionalArguments;
 	StartupFunctionPtr StartupFunction;
 	const char* HelpString;
 };
 
 const StartupMode StartupModes[] = {
-	{ "--prepare-test-file", 3, PrepareTestFile,
+	{ "--prepare-test-file", 3, 0, PrepareTestFile,
 		"--prepare-test-file TEXT_JSON_FILE" },
 
-	{ "--prepare-train-file", 4, PrepareTrainFile,
+	{ "--prepare-train-file", 4, 0, PrepareTrainFile,
 		"--prepare-train-file TEXT_JSON_FILE TEXT_ANN_FILE" },
 
-	{ "--prepare-answer-file", 4, PrepareAnswerFile,
+	{ "--prepare-answer-file", 4, 0, PrepareAnswerFile,
 		"--prepare-answer-file TEXT_JSON_FILE CRF_TESTED_FILE" },
 
-	{ nullptr, -1, nullptr, nullptr }
+	{ "--recognize", 3, 0, Recognize,
+		"--recognize TEXT_JSON_FILE" },
+
+	{ "--prepare-test-dir", 3, 1, PrepareTestDir,
+		"--prepare-test-dir TEXT_JSON_DIR|TEXT_JSON_FILE_LIST [THREADS]\n"
+		"    (TEXT.json -> TEXT.signs)" },
+
+	{ "--prepare-train-dir", 3, 1, PrepareTrainDir,
+		"--prepare-train-dir TEXT_JSON_DIR|TEXT_JSON_FILE_LIST [THREADS]\n"
+		"    (TEXT.json + TEXT.json.ann -> TEXT.json.signs)" },
+
+	{ "--recognize-dir", 3, 1, RecognizeDir,
+		"--recognize-dir TEXT_JSON_DIR|TEXT_JSON_FILE_LIST [THREADS]\n"
+		"    (TEXT.json -> TEXT.task1)" },
+
+	{ "--compile-gazetteers", 2, 1, CompileGazetteers,
+		"--compile-gazetteers [BUNDLE_FILE]\n"
+		"    (aux files -> binary bundle of them, by default it is saved to\n"
+		"    the aux files directory where all modes look for it)" },
+
+	{ "--verify-gazetteers", 2, 1, VerifyGazetteers,
+		"--verify-gazetteers [BUNDLE_FILE]\n"
+		"    (checks the checksum and the contents of the bundle)" },
+
+	{ "--serve", 3, 1, Serve,
+		"--serve SOCKET_PATH [THREADS]\n"
+		"    (mystem json of a text per connection -> task1 lines)" },
+
+	{ nullptr, -1, 0, nullptr, nullptr }
 };
 
 //------------------------------------------------------------------------------
@@ -1203,7 +5693,10 @@ bool Run( int argc, const char* argv[] )
 
 		for( int i = 0; StartupModes[i].FirstArgument != nullptr; i++ ) {
 			if( firstArgument == StartupModes[i].FirstArgument ) {
-				if( argc == StartupModes[i].NumberOfArguments ) {
+				if( argc >= StartupModes[i].NumberOfArguments
+					&& argc <= StartupModes[i].NumberOfArguments
+						+ StartupModes[i].NumberOfOptionalArguments )
+				{
 					startupMode = i;
 				}
 				break;